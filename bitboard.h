@@ -0,0 +1,256 @@
+#ifndef __BITBOARD_H__
+#define __BITBOARD_H__
+
+#include "main.h"
+#include "rng.h"
+
+// Fixed-size bitboard engine for the standard difficulties.
+//
+// Each plane (mines, open, flags) stores one bit per tile in row-major
+// order, packed into as few u64 words as the board needs. Neighbourhoods
+// are taken separably: a horizontal pass shifts by one column, then a
+// vertical pass shifts the result by one row. Neighbour counts sum the
+// shifted mine planes with bit-sliced adders into 4 count planes, and
+// flood fill dilates only the tiles added in the previous round until
+// no new zero tiles are reached.
+//
+// BITBOARD_DEFINE generates a board type and its functions for one size,
+// so every loop runs over a constant number of words and unrolls.
+
+// Boards of up to this many words (512 tiles) can be defined
+#define BITBOARD_MAX_WORDS 8
+
+// Column masks are constant expressions, so every instantiation gets
+// them as static tables. Bit k is set if tile k is on an n tile board
+// of width w and not in column col.
+#define BITBOARD_MASK_BIT(_w, _n, _col, _k) ((u64)((_k) < (_n) && (_k) % (_w) != (_col)) << ((_k) % 64))
+#define BITBOARD_MASK_BITS8(_w, _n, _col, _k)                                                   \
+    (BITBOARD_MASK_BIT(_w, _n, _col, (_k) + 0) | BITBOARD_MASK_BIT(_w, _n, _col, (_k) + 1)      \
+        | BITBOARD_MASK_BIT(_w, _n, _col, (_k) + 2) | BITBOARD_MASK_BIT(_w, _n, _col, (_k) + 3) \
+        | BITBOARD_MASK_BIT(_w, _n, _col, (_k) + 4) | BITBOARD_MASK_BIT(_w, _n, _col, (_k) + 5) \
+        | BITBOARD_MASK_BIT(_w, _n, _col, (_k) + 6) | BITBOARD_MASK_BIT(_w, _n, _col, (_k) + 7))
+#define BITBOARD_MASK_WORD(_w, _n, _col, _i)                                                                    \
+    (BITBOARD_MASK_BITS8(_w, _n, _col, (_i) * 64 + 0) | BITBOARD_MASK_BITS8(_w, _n, _col, (_i) * 64 + 8)        \
+        | BITBOARD_MASK_BITS8(_w, _n, _col, (_i) * 64 + 16) | BITBOARD_MASK_BITS8(_w, _n, _col, (_i) * 64 + 24) \
+        | BITBOARD_MASK_BITS8(_w, _n, _col, (_i) * 64 + 32) | BITBOARD_MASK_BITS8(_w, _n, _col, (_i) * 64 + 40) \
+        | BITBOARD_MASK_BITS8(_w, _n, _col, (_i) * 64 + 48) | BITBOARD_MASK_BITS8(_w, _n, _col, (_i) * 64 + 56))
+#define BITBOARD_MASK(_w, _n, _col)                                                   \
+    {                                                                                 \
+        BITBOARD_MASK_WORD(_w, _n, _col, 0), BITBOARD_MASK_WORD(_w, _n, _col, 1),     \
+            BITBOARD_MASK_WORD(_w, _n, _col, 2), BITBOARD_MASK_WORD(_w, _n, _col, 3), \
+            BITBOARD_MASK_WORD(_w, _n, _col, 4), BITBOARD_MASK_WORD(_w, _n, _col, 5), \
+            BITBOARD_MASK_WORD(_w, _n, _col, 6), BITBOARD_MASK_WORD(_w, _n, _col, 7), \
+    }
+
+// out = in shifted towards higher tile indices by k (0 < k < 64)
+static inline void bitboard_shl(u64* out, const u64* in, usize n, usize k)
+{
+    for (usize i = n; i-- > 0;) {
+        out[i] = in[i] << k | (i > 0 ? in[i - 1] >> (64 - k) : 0);
+    }
+}
+
+// out = in shifted towards lower tile indices by k (0 < k < 64)
+static inline void bitboard_shr(u64* out, const u64* in, usize n, usize k)
+{
+    for (usize i = 0; i < n; i++) {
+        out[i] = in[i] >> k | (i + 1 < n ? in[i + 1] << (64 - k) : 0);
+    }
+}
+
+// Add plane, weighted by 2^bit, to the bit-sliced 4 bit counters in sum
+static inline void bitboard_add(u64 sum[4], u64 plane, usize bit)
+{
+    u64 carry = plane;
+    for (usize i = bit; i < 4; i++) {
+        u64 next = sum[i] & carry;
+        sum[i] ^= carry;
+        carry = next;
+    }
+}
+
+static inline usize bitboard_popcount(const u64* in, usize n)
+{
+    usize count = 0;
+    for (usize i = 0; i < n; i++) {
+        count += __builtin_popcountll(in[i]);
+    }
+    return count;
+}
+
+// Index of the k-th (0 based) set bit
+static inline usize bitboard_select(const u64* in, usize n, usize k)
+{
+    for (usize i = 0; i < n; i++) {
+        usize count = __builtin_popcountll(in[i]);
+        if (k < count) {
+            u64 word = in[i];
+            for (; k > 0; k--) {
+                word &= word - 1;
+            }
+            return i * 64 + __builtin_ctzll(word);
+        }
+        k -= count;
+    }
+    unreachable();
+}
+
+#define BITBOARD_DEFINE(_type, _name, _width, _height)                                                   \
+    enum {                                                                                               \
+        _name##_w = (_width),                                                                            \
+        _name##_h = (_height),                                                                           \
+        _name##_words = ((_width) * (_height) + 63) / 64,                                                \
+    };                                                                                                   \
+                                                                                                         \
+    typedef struct {                                                                                     \
+        u64 mine[((_width) * (_height) + 63) / 64];                                                      \
+        u64 open[((_width) * (_height) + 63) / 64];                                                      \
+        u64 flag[((_width) * (_height) + 63) / 64];                                                      \
+        /* Safe tiles without nearby mines */                                                            \
+        u64 zero[((_width) * (_height) + 63) / 64];                                                      \
+        /* Nearby mine count, bit i of every tile's count in count[i] */                                 \
+        u64 count[4][((_width) * (_height) + 63) / 64];                                                  \
+    } _type;                                                                                             \
+                                                                                                         \
+    _Static_assert(_name##_words <= BITBOARD_MAX_WORDS, #_type " is too large");                         \
+                                                                                                         \
+    /* [0]: all tiles, [1]/[2]: all tiles but the first/last column */                                   \
+    static const u64 _name##_masks[3][BITBOARD_MAX_WORDS] = {                                            \
+        BITBOARD_MASK(_width, (_width) * (_height), (_width)),                                           \
+        BITBOARD_MASK(_width, (_width) * (_height), 0),                                                  \
+        BITBOARD_MASK(_width, (_width) * (_height), (_width) - 1),                                       \
+    };                                                                                                   \
+                                                                                                         \
+    /* west/east: tiles whose western/eastern neighbour is set in in */                                  \
+    static inline void _name##_shift_columns(u64* west, u64* east, const u64* in)                        \
+    {                                                                                                    \
+        bitboard_shl(west, in, _name##_words, 1);                                                        \
+        bitboard_shr(east, in, _name##_words, 1);                                                        \
+        for (usize i = 0; i < _name##_words; i++) {                                                      \
+            west[i] &= _name##_masks[1][i];                                                              \
+            east[i] &= _name##_masks[2][i];                                                              \
+        }                                                                                                \
+    }                                                                                                    \
+                                                                                                         \
+    /* out = in and the 8 neighbours of every tile in in */                                              \
+    static inline void _name##_dilate(u64* out, const u64* in)                                           \
+    {                                                                                                    \
+        u64 row[_name##_words], west[_name##_words], east[_name##_words];                                \
+        _name##_shift_columns(west, east, in);                                                           \
+        for (usize i = 0; i < _name##_words; i++) {                                                      \
+            row[i] = in[i] | west[i] | east[i];                                                          \
+        }                                                                                                \
+        u64 up[_name##_words], down[_name##_words];                                                      \
+        bitboard_shl(down, row, _name##_words, (_width));                                                \
+        bitboard_shr(up, row, _name##_words, (_width));                                                  \
+        for (usize i = 0; i < _name##_words; i++) {                                                      \
+            out[i] = (row[i] | up[i] | down[i]) & _name##_masks[0][i];                                   \
+        }                                                                                                \
+    }                                                                                                    \
+                                                                                                         \
+    /* Compute count and zero from the mine plane */                                                     \
+    static inline void _name##_count(_type* self)                                                        \
+    {                                                                                                    \
+        /* Mines in each tile's row of 3, as a 2 bit count, */                                           \
+        /* then those of the rows above and below are added */                                           \
+        u64 west[_name##_words], east[_name##_words];                                                    \
+        _name##_shift_columns(west, east, self->mine);                                                   \
+        u64 row[2][_name##_words];                                                                       \
+        for (usize i = 0; i < _name##_words; i++) {                                                      \
+            u64 m = self->mine[i];                                                                       \
+            row[0][i] = m ^ west[i] ^ east[i];                                                           \
+            row[1][i] = (m & west[i]) | (m & east[i]) | (west[i] & east[i]);                             \
+        }                                                                                                \
+        u64 up[2][_name##_words], down[2][_name##_words];                                                \
+        for (usize b = 0; b < 2; b++) {                                                                  \
+            bitboard_shl(down[b], row[b], _name##_words, (_width));                                      \
+            bitboard_shr(up[b], row[b], _name##_words, (_width));                                        \
+        }                                                                                                \
+        for (usize i = 0; i < _name##_words; i++) {                                                      \
+            u64 sum[4] = { 0 };                                                                          \
+            bitboard_add(sum, west[i], 0);                                                               \
+            bitboard_add(sum, east[i], 0);                                                               \
+            for (usize b = 0; b < 2; b++) {                                                              \
+                bitboard_add(sum, up[b][i] & _name##_masks[0][i], b);                                    \
+                bitboard_add(sum, down[b][i] & _name##_masks[0][i], b);                                  \
+            }                                                                                            \
+            for (usize b = 0; b < 4; b++) {                                                              \
+                self->count[b][i] = sum[b];                                                              \
+            }                                                                                            \
+            self->zero[i] = ~(sum[0] | sum[1] | sum[2] | sum[3]) & ~self->mine[i] & _name##_masks[0][i]; \
+        }                                                                                                \
+    }                                                                                                    \
+                                                                                                         \
+    /* Place mines randomly, keeping the 3x3 area around safe_x and safe_y free */                       \
+    static inline void _name##_generate(_type* self, RNG* rng, usize mines, usize safe_x, usize safe_y)  \
+    {                                                                                                    \
+        *self = (_type) { 0 };                                                                           \
+        for (usize n = 0; n < mines;) {                                                                  \
+            usize i = rng_u64_cap(rng, (_width) * (_height));                                            \
+            isize dx = (isize)(i % (_width)) - (isize)safe_x;                                            \
+            isize dy = (isize)(i / (_width)) - (isize)safe_y;                                            \
+            u64 bit = (u64)1 << (i % 64);                                                                \
+            if ((dx >= -1 && dx <= 1 && dy >= -1 && dy <= 1) || (self->mine[i / 64] & bit)) {            \
+                continue;                                                                                \
+            }                                                                                            \
+            self->mine[i / 64] |= bit;                                                                   \
+            n++;                                                                                         \
+        }                                                                                                \
+        _name##_count(self);                                                                             \
+    }                                                                                                    \
+                                                                                                         \
+    static inline u8 _name##_nearby_mines(const _type* self, usize x, usize y)                           \
+    {                                                                                                    \
+        usize i = y * (_width) + x;                                                                      \
+        u8 n = 0;                                                                                        \
+        for (usize b = 0; b < 4; b++) {                                                                  \
+            n |= ((self->count[b][i / 64] >> (i % 64)) & 1) << b;                                        \
+        }                                                                                                \
+        return n;                                                                                        \
+    }                                                                                                    \
+                                                                                                         \
+    /* Open the tile at x and y and flood fill from it. Returns false on a mine. */                      \
+    static inline bool _name##_explore(_type* self, usize x, usize y)                                    \
+    {                                                                                                    \
+        usize i = y * (_width) + x;                                                                      \
+        u64 bit = (u64)1 << (i % 64);                                                                    \
+        if (self->mine[i / 64] & bit) {                                                                  \
+            return false;                                                                                \
+        }                                                                                                \
+        /* Only zero tiles added in the last round can reach new tiles. */                               \
+        /* Open tiles are never added again: a flood fill that opened */                                 \
+        /* them already opened all their neighbours. */                                                  \
+        u64 region[_name##_words] = { 0 }, frontier[_name##_words] = { 0 };                              \
+        region[i / 64] = bit & ~self->open[i / 64];                                                      \
+        frontier[i / 64] = region[i / 64] & self->zero[i / 64];                                          \
+        bool grow = frontier[i / 64] != 0;                                                               \
+        while (grow) {                                                                                   \
+            u64 grown[_name##_words];                                                                    \
+            _name##_dilate(grown, frontier);                                                             \
+            grow = false;                                                                                \
+            for (usize j = 0; j < _name##_words; j++) {                                                  \
+                u64 added = grown[j] & ~region[j] & ~self->open[j];                                      \
+                region[j] |= added;                                                                      \
+                frontier[j] = added & self->zero[j];                                                     \
+                grow |= frontier[j] != 0;                                                                \
+            }                                                                                            \
+        }                                                                                                \
+        for (usize j = 0; j < _name##_words; j++) {                                                      \
+            self->open[j] |= region[j];                                                                  \
+        }                                                                                                \
+        return true;                                                                                     \
+    }                                                                                                    \
+                                                                                                         \
+    /* All safe tiles are open (mines are never opened) */                                               \
+    static inline bool _name##_won(const _type* self)                                                    \
+    {                                                                                                    \
+        return bitboard_popcount(self->open, _name##_words)                                              \
+            + bitboard_popcount(self->mine, _name##_words)                                               \
+            == (_width) * (_height);                                                                     \
+    }
+
+BITBOARD_DEFINE(Bitboard9x9, bitboard9x9, 9, 9)
+BITBOARD_DEFINE(Bitboard16x16, bitboard16x16, 16, 16)
+BITBOARD_DEFINE(Bitboard20x20, bitboard20x20, 20, 20)
+
+#endif // __BITBOARD_H__
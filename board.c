@@ -0,0 +1,571 @@
+#include "board.h"
+
+#include <pthread.h>
+#include <string.h>
+
+// Open the padding tiles, so flood fills stop at them
+static void board_pad(Board* self)
+{
+    for (usize x = 0; x < self->stride; x++) {
+        self->tiles[x].open = true;
+        self->tiles[(self->h + 1) * self->stride + x].open = true;
+    }
+    for (usize y = 1; y <= self->h; y++) {
+        self->tiles[y * self->stride].open = true;
+        self->tiles[y * self->stride + self->w + 1].open = true;
+    }
+}
+
+Board board_init_buffer(Tile* tiles, usize width, usize height, BoardTopology topology)
+{
+    Board self = {
+        .tiles = tiles,
+        .w = width,
+        .h = height,
+        .stride = width + 2,
+        .topology = topology,
+    };
+
+    isize stride = self.stride;
+    isize neighbours[8] = {
+        -stride - 1,
+        -stride,
+        -stride + 1,
+        -1,
+        1,
+        stride - 1,
+        stride,
+        stride + 1,
+    };
+    memcpy(self.neighbours, neighbours, sizeof(neighbours));
+
+    board_clear(&self);
+
+    return self;
+}
+
+Board board_init_ex(usize width, usize height, BoardTopology topology)
+{
+    Tile* tiles;
+    if (!(tiles = malloc(BOARD_TILES_LEN(width, height) * sizeof(Tile)))) {
+        panic("Out of memory!");
+    }
+
+    return board_init_buffer(tiles, width, height, topology);
+}
+
+Board board_init(usize width, usize height)
+{
+    return board_init_ex(width, height, BOARD_TOPOLOGY_BOUNDED);
+}
+
+void board_deinit(const Board* self)
+{
+    free(self->tiles);
+}
+
+void board_clear(Board* self)
+{
+    memset(self->tiles, 0, board_tiles_len(self) * sizeof(Tile));
+    board_pad(self);
+}
+
+void board_wrap_neighbours(const Board* self, usize index, usize out[8])
+{
+    // Only tiles on the edge have neighbours in the padding
+    usize x = index % self->stride;
+    usize y = index / self->stride;
+    if (x > 1 && x < self->w && y > 1 && y < self->h) {
+        return;
+    }
+    for (usize i = 0; i < 8; i++) {
+        usize nx = out[i] % self->stride;
+        usize ny = out[i] / self->stride;
+        nx = nx == 0 ? self->w : nx == self->w + 1 ? 1 : nx;
+        ny = ny == 0 ? self->h : ny == self->h + 1 ? 1 : ny;
+        out[i] = ny * self->stride + nx;
+    }
+}
+
+void board_generate(Board* self, RNG* rng, usize mines, usize safe_x, usize safe_y)
+{
+    usize* random_tile_indices;
+    if (!(random_tile_indices = calloc(self->w * self->h, sizeof(usize)))) {
+        panic("Out of memory!");
+    }
+    for (usize i = 0; i < self->w * self->h; i++) {
+        random_tile_indices[i] = i;
+    }
+
+    // Fisher-Yates shuffle
+    for (usize i = self->w * self->h - 1; i > 0; i--) {
+        usize j = rng_u64_cap(rng, i + 1);
+        swap(usize, random_tile_indices[i], random_tile_indices[j]);
+    }
+
+    // Place mines, ensuring that there is a 3x3 "safe" area around safe_x and safe_y.
+    // Neighbours in the padding never match a tile on the board.
+    usize safe[9];
+    safe[0] = board_index(self, safe_x, safe_y);
+    board_neighbours(self, safe[0], safe + 1);
+    for (usize i = 0, n = 0; n < mines; i++) {
+        if (i >= self->w * self->h) {
+            panic("ran out of tile indices placing while mines");
+        }
+        usize index = board_index(self, random_tile_indices[i] % self->w, random_tile_indices[i] / self->w);
+        bool outside_safe_area = true;
+        for (usize j = 0; j < arrlen(safe); j++) {
+            outside_safe_area &= safe[j] != index;
+        }
+        if (outside_safe_area) {
+            self->tiles[index].mine = true;
+            n++;
+        }
+    }
+
+    free(random_tile_indices);
+
+    for (usize y = 0; y < self->h; y++) {
+        for (usize x = 0; x < self->w; x++) {
+            usize index = board_index(self, x, y);
+            usize neighbours[8];
+            board_neighbours(self, index, neighbours);
+            u8 nearby_mines = 0;
+            for (usize i = 0; i < arrlen(neighbours); i++) {
+                nearby_mines += self->tiles[neighbours[i]].mine;
+            }
+            self->tiles[index].nearby_mines = nearby_mines;
+        }
+    }
+}
+
+void board_explore(Board* self, usize x, usize y)
+{
+    usize index = board_index(self, x, y);
+
+    if (self->tiles[index].open) {
+        return;
+    }
+    self->tiles[index].open = true;
+
+    if (self->tiles[index].nearby_mines > 0) {
+        return;
+    }
+
+    // Use an explicit stack instead of recursing,
+    // so large empty areas can't overflow the call stack
+    usize stack_cap = 64;
+    usize stack_len = 0;
+    usize* stack;
+    if (!(stack = malloc(stack_cap * sizeof(usize)))) {
+        panic("Out of memory!");
+    }
+    stack[stack_len++] = index;
+
+    while (stack_len > 0) {
+        usize neighbours[8];
+        board_neighbours(self, stack[--stack_len], neighbours);
+        for (usize i = 0; i < arrlen(neighbours); i++) {
+            Tile* tile = &self->tiles[neighbours[i]];
+            if (tile->open) {
+                continue;
+            }
+            tile->open = true;
+            if (tile->nearby_mines > 0) {
+                continue;
+            }
+            if (stack_len == stack_cap) {
+                stack_cap *= 2;
+                if (!(stack = realloc(stack, stack_cap * sizeof(usize)))) {
+                    panic("Out of memory!");
+                }
+            }
+            stack[stack_len++] = neighbours[i];
+        }
+    }
+
+    free(stack);
+}
+
+// Maximum number of tiles taken from another thread's deque at once
+#define EXPLORE_STEAL_MAX 256
+// Size of a thread's private stack above which half of it is shared
+// while another thread is idle
+#define EXPLORE_SHARE_MIN 8
+// Size of a thread's private stack at which half of it is always shared
+#define EXPLORE_SHARE_MAX 64
+
+// Tile indices waiting to have their neighbours opened. The
+// owning thread pushes and pops at the tail, other threads
+// steal from the head, where the oldest (and usually
+// largest) parts of the frontier are.
+typedef struct {
+    pthread_mutex_t lock;
+    usize* items;
+    usize head;
+    usize tail;
+    usize cap;
+} ExploreDeque;
+
+typedef struct {
+    Board* board;
+    ExploreDeque* deques;
+    usize n_threads;
+    // Number of tiles in all deques plus the number of threads
+    // working through their private stacks, only accessed atomically.
+    // It only changes when tiles are shared or taken from a deque and
+    // when a thread runs out of work, not for every tile. Once this
+    // reaches zero, no new work can appear and the threads can finish.
+    usize pending;
+    // Number of tiles in all deques, only accessed atomically
+    usize available;
+    // Threads without work wait on idle_cond until tiles are shared
+    // or the fill is done, instead of spinning. idle is only accessed
+    // atomically, so busy threads can check it without the lock.
+    pthread_mutex_t idle_lock;
+    pthread_cond_t idle_cond;
+    usize idle;
+} ExploreShared;
+
+typedef struct {
+    ExploreShared* shared;
+    usize id;
+    pthread_t thread;
+} ExploreWorker;
+
+static void explore_deque_push(ExploreDeque* self, const usize* indices, usize len)
+{
+    pthread_mutex_lock(&self->lock);
+    if (self->tail + len > self->cap) {
+        if (self->head > 0) {
+            memmove(self->items, self->items + self->head, (self->tail - self->head) * sizeof(usize));
+            self->tail -= self->head;
+            self->head = 0;
+        }
+        while (self->tail + len > self->cap) {
+            self->cap *= 2;
+        }
+        if (!(self->items = realloc(self->items, self->cap * sizeof(usize)))) {
+            panic("Out of memory!");
+        }
+    }
+    memcpy(self->items + self->tail, indices, len * sizeof(usize));
+    self->tail += len;
+    pthread_mutex_unlock(&self->lock);
+}
+
+// Move up to max of the newest tiles to out, returns their number
+static usize explore_deque_pop(ExploreDeque* self, usize* out, usize max)
+{
+    pthread_mutex_lock(&self->lock);
+    usize n = min(self->tail - self->head, max);
+    self->tail -= n;
+    memcpy(out, self->items + self->tail, n * sizeof(usize));
+    if (self->tail == self->head) {
+        self->head = 0;
+        self->tail = 0;
+    }
+    pthread_mutex_unlock(&self->lock);
+    return n;
+}
+
+// Move up to half of victim's tiles to self
+static bool explore_deque_steal(ExploreDeque* self, ExploreDeque* victim)
+{
+    usize stolen[EXPLORE_STEAL_MAX];
+    usize n;
+
+    pthread_mutex_lock(&victim->lock);
+    n = min((victim->tail - victim->head + 1) / 2, arrlen(stolen));
+    memcpy(stolen, victim->items + victim->head, n * sizeof(usize));
+    victim->head += n;
+    if (victim->tail == victim->head) {
+        victim->head = 0;
+        victim->tail = 0;
+    }
+    pthread_mutex_unlock(&victim->lock);
+
+    if (n == 0) {
+        return false;
+    }
+    explore_deque_push(self, stolen, n);
+    return true;
+}
+
+// Wake the idle threads, after sharing tiles or finishing
+static void explore_wake(ExploreShared* self)
+{
+    pthread_mutex_lock(&self->idle_lock);
+    pthread_cond_broadcast(&self->idle_cond);
+    pthread_mutex_unlock(&self->idle_lock);
+}
+
+// Block until tiles are available to steal or the fill is done. idle
+// and available are sequentially consistent, so either this thread
+// sees the shared tiles or the sharing thread sees it idle and wakes it.
+static void explore_wait(ExploreShared* self)
+{
+    pthread_mutex_lock(&self->idle_lock);
+    __atomic_add_fetch(&self->idle, 1, __ATOMIC_SEQ_CST);
+    while (__atomic_load_n(&self->available, __ATOMIC_SEQ_CST) == 0
+        && __atomic_load_n(&self->pending, __ATOMIC_SEQ_CST) != 0) {
+        pthread_cond_wait(&self->idle_cond, &self->idle_lock);
+    }
+    __atomic_sub_fetch(&self->idle, 1, __ATOMIC_SEQ_CST);
+    pthread_mutex_unlock(&self->idle_lock);
+}
+
+static void* explore_worker(void* _self)
+{
+    ExploreWorker* self = _self;
+    ExploreShared* shared = self->shared;
+    Board* board = shared->board;
+    ExploreDeque* deque = &shared->deques[self->id];
+
+    // Tiles are processed from a private stack without any locking,
+    // only the surplus is shared through the deque for others to steal
+    usize local_cap = EXPLORE_SHARE_MAX + 8;
+    usize local_len = 0;
+    usize* local;
+    if (!(local = malloc(local_cap * sizeof(usize)))) {
+        panic("Out of memory!");
+    }
+
+    // Whether this thread is counted in pending
+    bool busy = false;
+    for (;;) {
+        if (local_len == 0) {
+            // Refill the private stack in one go, so shared tiles
+            // don't each cost a lock when they come back
+            usize n = explore_deque_pop(deque, local, EXPLORE_SHARE_MAX / 2);
+            if (n > 0) {
+                // The tiles leave the deque, offset by one if
+                // the thread becomes busy with them
+                __atomic_sub_fetch(&shared->available, n, __ATOMIC_SEQ_CST);
+                __atomic_sub_fetch(&shared->pending, busy ? n : n - 1, __ATOMIC_SEQ_CST);
+                busy = true;
+                local_len = n;
+            }
+        }
+        if (local_len == 0) {
+            if (busy) {
+                busy = false;
+                if (__atomic_sub_fetch(&shared->pending, 1, __ATOMIC_SEQ_CST) == 0) {
+                    explore_wake(shared);
+                }
+            }
+            if (__atomic_load_n(&shared->pending, __ATOMIC_ACQUIRE) == 0) {
+                break;
+            }
+            // Stolen tiles move between deques, available stays the same
+            bool stolen = false;
+            for (usize i = 1; i < shared->n_threads && !stolen; i++) {
+                usize victim = (self->id + i) % shared->n_threads;
+                stolen = explore_deque_steal(deque, &shared->deques[victim]);
+            }
+            if (!stolen) {
+                explore_wait(shared);
+            }
+            continue;
+        }
+
+        usize neighbours[8];
+        board_neighbours(board, local[--local_len], neighbours);
+        for (usize i = 0; i < arrlen(neighbours); i++) {
+            Tile* tile = &board->tiles[neighbours[i]];
+            // Two threads can both see a tile closed and both push it.
+            // That only costs a redundant visit, since pending doesn't
+            // count single tiles, and is much cheaper than claiming
+            // every tile with a locked exchange.
+            if (__atomic_load_n(&tile->open, __ATOMIC_RELAXED)) {
+                continue;
+            }
+            __atomic_store_n(&tile->open, true, __ATOMIC_RELAXED);
+            if (tile->nearby_mines == 0) {
+                local[local_len++] = neighbours[i];
+            }
+        }
+
+        // Hand the older half of the private stack over to the deque,
+        // keeping the newest tiles for ourselves. That happens whenever
+        // it grows large, and as soon as it holds more than a few tiles
+        // (or any to spare, if nothing is left to steal) while another
+        // thread is idle, so narrow regions get split up too.
+        usize idle = __atomic_load_n(&shared->idle, __ATOMIC_RELAXED);
+        if (local_len >= EXPLORE_SHARE_MAX
+            || (idle > 0 && local_len >= 2
+                && (local_len > EXPLORE_SHARE_MIN || __atomic_load_n(&shared->available, __ATOMIC_RELAXED) == 0))) {
+            // Counted before they can be taken, so a thread that takes
+            // and finishes them can't bring pending down to zero early
+            usize n = local_len / 2;
+            __atomic_add_fetch(&shared->pending, n, __ATOMIC_SEQ_CST);
+            __atomic_add_fetch(&shared->available, n, __ATOMIC_SEQ_CST);
+            explore_deque_push(deque, local, n);
+            memmove(local, local + n, (local_len - n) * sizeof(usize));
+            local_len -= n;
+            if (__atomic_load_n(&shared->idle, __ATOMIC_SEQ_CST) > 0) {
+                explore_wake(shared);
+            }
+        }
+    }
+
+    free(local);
+
+    return NULL;
+}
+
+void board_explore_parallel(Board* self, usize x, usize y, usize n_threads)
+{
+    if (n_threads <= 1 || self->w * self->h < BOARD_PARALLEL_EXPLORE_MIN_TILES) {
+        board_explore(self, x, y);
+        return;
+    }
+
+    usize index = board_index(self, x, y);
+
+    if (self->tiles[index].open) {
+        return;
+    }
+    self->tiles[index].open = true;
+
+    if (self->tiles[index].nearby_mines > 0) {
+        return;
+    }
+
+    ExploreShared shared = {
+        .board = self,
+        .n_threads = n_threads,
+        .pending = 1,
+        .available = 1,
+    };
+    pthread_mutex_init(&shared.idle_lock, NULL);
+    pthread_cond_init(&shared.idle_cond, NULL);
+    ExploreWorker* workers;
+    if (!(shared.deques = calloc(n_threads, sizeof(ExploreDeque)))
+        || !(workers = calloc(n_threads, sizeof(ExploreWorker)))) {
+        panic("Out of memory!");
+    }
+    for (usize i = 0; i < n_threads; i++) {
+        ExploreDeque* deque = &shared.deques[i];
+        pthread_mutex_init(&deque->lock, NULL);
+        deque->cap = 1024;
+        if (!(deque->items = malloc(deque->cap * sizeof(usize)))) {
+            panic("Out of memory!");
+        }
+        workers[i].shared = &shared;
+        workers[i].id = i;
+    }
+    explore_deque_push(&shared.deques[0], &index, 1);
+
+    // The calling thread acts as worker 0
+    for (usize i = 1; i < n_threads; i++) {
+        if (pthread_create(&workers[i].thread, NULL, explore_worker, &workers[i]) != 0) {
+            panic("failed to create explore thread");
+        }
+    }
+    explore_worker(&workers[0]);
+    for (usize i = 1; i < n_threads; i++) {
+        pthread_join(workers[i].thread, NULL);
+    }
+
+    for (usize i = 0; i < n_threads; i++) {
+        pthread_mutex_destroy(&shared.deques[i].lock);
+        free(shared.deques[i].items);
+    }
+    pthread_cond_destroy(&shared.idle_cond);
+    pthread_mutex_destroy(&shared.idle_lock);
+    free(shared.deques);
+    free(workers);
+}
+
+BoardExplorer board_explorer_init(void)
+{
+    BoardExplorer self = {
+        .queue_cap = 64,
+        .opened_cap = 64,
+    };
+
+    if (!(self.queue = malloc(self.queue_cap * sizeof(usize)))
+        || !(self.opened = malloc(self.opened_cap * sizeof(usize)))) {
+        panic("Out of memory!");
+    }
+
+    return self;
+}
+
+void board_explorer_deinit(const BoardExplorer* self)
+{
+    free(self->queue);
+    free(self->opened);
+}
+
+static void board_explorer_opened(BoardExplorer* self, usize index)
+{
+    if (self->opened_len == self->opened_cap) {
+        self->opened_cap *= 2;
+        if (!(self->opened = realloc(self->opened, self->opened_cap * sizeof(usize)))) {
+            panic("Out of memory!");
+        }
+    }
+    self->opened[self->opened_len++] = index;
+}
+
+static void board_explorer_push(BoardExplorer* self, usize index)
+{
+    if (self->queue_len == self->queue_cap) {
+        usize old_cap = self->queue_cap;
+        self->queue_cap *= 2;
+        if (!(self->queue = realloc(self->queue, self->queue_cap * sizeof(usize)))) {
+            panic("Out of memory!");
+        }
+        // Unwrap the part of the ring buffer that wrapped around
+        usize wrapped = self->queue_head + self->queue_len - old_cap;
+        if (self->queue_head + self->queue_len > old_cap) {
+            memcpy(self->queue + old_cap, self->queue, wrapped * sizeof(usize));
+        }
+    }
+    self->queue[(self->queue_head + self->queue_len) % self->queue_cap] = index;
+    self->queue_len++;
+}
+
+void board_explorer_start(BoardExplorer* self, Board* board, usize x, usize y)
+{
+    usize index = board_index(board, x, y);
+
+    if (board->tiles[index].open) {
+        return;
+    }
+    board->tiles[index].open = true;
+    board_explorer_opened(self, index);
+
+    if (board->tiles[index].nearby_mines > 0) {
+        return;
+    }
+
+    board_explorer_push(self, index);
+}
+
+bool board_explorer_step(BoardExplorer* self, Board* board, usize budget)
+{
+    for (; budget > 0 && self->queue_len > 0; budget--) {
+        usize index = self->queue[self->queue_head];
+        self->queue_head = (self->queue_head + 1) % self->queue_cap;
+        self->queue_len--;
+
+        usize neighbours[8];
+        board_neighbours(board, index, neighbours);
+        for (usize i = 0; i < arrlen(neighbours); i++) {
+            Tile* tile = &board->tiles[neighbours[i]];
+            if (tile->open) {
+                continue;
+            }
+            tile->open = true;
+            board_explorer_opened(self, neighbours[i]);
+            if (tile->nearby_mines == 0) {
+                board_explorer_push(self, neighbours[i]);
+            }
+        }
+    }
+
+    return self->queue_len > 0;
+}
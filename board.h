@@ -0,0 +1,126 @@
+#ifndef __BOARD_H__
+#define __BOARD_H__
+
+#include "main.h"
+#include "rng.h"
+
+// Boards with fewer tiles than this are always explored
+// sequentially, since spinning up threads costs more
+// than the flood fill itself.
+#define BOARD_PARALLEL_EXPLORE_MIN_TILES ((usize)1 << 20)
+
+typedef struct {
+    bool mine;
+    bool flag;
+    bool open;
+    u8 nearby_mines;
+} Tile;
+
+typedef enum {
+    BOARD_TOPOLOGY_BOUNDED,
+    // Edges wrap around to the opposite side,
+    // needs a board of at least 3x3 tiles
+    BOARD_TOPOLOGY_TORUS,
+} BoardTopology;
+
+// Tiles are stored with a border of one padding tile on every side,
+// which is always open and never a mine. Walking the neighbours of
+// any tile on the board is then a matter of adding the 8 offsets in
+// neighbours to its index, without any bounds checks: padding tiles
+// never count as mines and flood fills stop at them. On a torus the
+// offsets of tiles on the edge are wrapped to the opposite side.
+typedef struct {
+    Tile* tiles; // BOARD_TILES_LEN(w, h) tiles, row-major with padding
+    usize w;
+    usize h;
+    usize stride; // w + 2
+    isize neighbours[8];
+    BoardTopology topology;
+} Board;
+
+#define BOARD_TILES_LEN(_w, _h) (((_w) + 2) * ((_h) + 2))
+
+// Resumable flood fill. Tiles are opened in breadth-first
+// order, so a reveal spreads out from the click as a wavefront
+// and can be spread over several frames.
+typedef struct {
+    usize* queue; // ring buffer of open tiles without nearby mines
+    usize queue_head;
+    usize queue_len;
+    usize queue_cap;
+    // Indices of all tiles opened by board_explorer_start and
+    // board_explorer_step, until the caller resets opened_len
+    usize* opened;
+    usize opened_len;
+    usize opened_cap;
+} BoardExplorer;
+
+static inline usize board_index(const Board* self, usize x, usize y)
+{
+    return (y + 1) * self->stride + x + 1;
+}
+
+static inline usize board_x(const Board* self, usize index)
+{
+    return index % self->stride - 1;
+}
+
+static inline usize board_y(const Board* self, usize index)
+{
+    return index / self->stride - 1;
+}
+
+// Number of tiles including padding, all indices are below this
+static inline usize board_tiles_len(const Board* self)
+{
+    return self->stride * (self->h + 2);
+}
+
+void board_wrap_neighbours(const Board* self, usize index, usize out[8]);
+
+// Indices of the 8 neighbours of the tile at index
+static inline void board_neighbours(const Board* self, usize index, usize out[8])
+{
+    for (usize i = 0; i < 8; i++) {
+        out[i] = index + self->neighbours[i];
+    }
+    if (self->topology == BOARD_TOPOLOGY_TORUS) {
+        board_wrap_neighbours(self, index, out);
+    }
+}
+
+Board board_init(usize width, usize height);
+Board board_init_ex(usize width, usize height, BoardTopology topology);
+// Lay out an empty board in a caller-provided buffer of at least
+// BOARD_TILES_LEN(width, height) tiles, e.g. to reuse it across games.
+// The board doesn't own the buffer and must not be deinitialized.
+Board board_init_buffer(Tile* tiles, usize width, usize height, BoardTopology topology);
+void board_deinit(const Board* self);
+// Close all tiles and remove all mines and flags
+void board_clear(Board* self);
+// Place mines randomly, keeping the 3x3 area around
+// safe_x and safe_y free, and count nearby mines
+void board_generate(Board* self, RNG* rng, usize mines, usize safe_x, usize safe_y);
+// Open the tile at x and y and flood fill all
+// connected tiles without nearby mines
+void board_explore(Board* self, usize x, usize y);
+// Same as board_explore, but distributes the flood fill
+// over n_threads work-stealing threads. The resulting board
+// state is identical to that of board_explore.
+void board_explore_parallel(Board* self, usize x, usize y, usize n_threads);
+
+BoardExplorer board_explorer_init(void);
+void board_explorer_deinit(const BoardExplorer* self);
+// Open the tile at x and y and queue its neighbours, if it has no nearby
+// mines. Can be called while a previous reveal is still in progress.
+void board_explorer_start(BoardExplorer* self, Board* board, usize x, usize y);
+// Continue the flood fill, processing at most budget queued tiles.
+// Returns true if there is work left.
+bool board_explorer_step(BoardExplorer* self, Board* board, usize budget);
+
+static inline bool board_explorer_busy(const BoardExplorer* self)
+{
+    return self->queue_len > 0;
+}
+
+#endif // __BOARD_H__
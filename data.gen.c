@@ -0,0 +1,1028 @@
+/* AUTOMATICALLY GENERATED SOURCE FILE */
+
+/* tile_closed.png */
+const unsigned char data_tile_closed_png[589] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 
+    0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x90, 0x91, 0x68, 0x36, 0x00, 0x00, 0x01, 
+    0x85, 0x69, 0x43, 0x43, 0x50, 0x49, 0x43, 0x43, 0x20, 0x70, 0x72, 0x6f, 
+    0x66, 0x69, 0x6c, 0x65, 0x00, 0x00, 0x28, 0x91, 0x7d, 0x91, 0x3b, 0x48, 
+    0xc3, 0x50, 0x14, 0x86, 0xff, 0xa6, 0xd6, 0x8a, 0x54, 0x1c, 0xec, 0x20, 
+    0x3e, 0x20, 0x43, 0x75, 0xb2, 0x8b, 0x8a, 0x38, 0xd6, 0x2a, 0x14, 0xa1, 
+    0x42, 0xa8, 0x15, 0x5a, 0x75, 0x30, 0xb9, 0xe9, 0x0b, 0x9a, 0x34, 0x24, 
+    0x29, 0x2e, 0x8e, 0x82, 0x6b, 0xc1, 0xc1, 0xc7, 0x62, 0xd5, 0xc1, 0xc5, 
+    0x59, 0x57, 0x07, 0x57, 0x41, 0x10, 0x7c, 0x80, 0xb8, 0xba, 0x38, 0x29, 
+    0xba, 0x48, 0x89, 0xe7, 0x26, 0x85, 0x16, 0xb1, 0x1e, 0xb8, 0xdc, 0x8f, 
+    0xff, 0x9e, 0xff, 0xe7, 0xde, 0x73, 0x01, 0xa1, 0x5e, 0x66, 0x9a, 0xd5, 
+    0x15, 0x03, 0x34, 0xdd, 0x36, 0x53, 0x89, 0xb8, 0x98, 0xc9, 0xae, 0x8a, 
+    0xc1, 0x57, 0x04, 0xd0, 0x0d, 0x1f, 0x46, 0x31, 0x2c, 0x33, 0xcb, 0x98, 
+    0x93, 0xa4, 0x24, 0x3a, 0xd6, 0xd7, 0x3d, 0x75, 0x52, 0xdd, 0x45, 0x79, 
+    0x56, 0xe7, 0xbe, 0x3f, 0xab, 0x4f, 0xcd, 0x59, 0x0c, 0xf0, 0x89, 0xc4, 
+    0x31, 0x66, 0x98, 0x36, 0xf1, 0x06, 0xf1, 0xcc, 0xa6, 0x6d, 0x70, 0xde, 
+    0x27, 0x0e, 0xb3, 0xa2, 0xac, 0x12, 0x9f, 0x13, 0x4f, 0x98, 0x74, 0x41, 
+    0xe2, 0x47, 0xae, 0x2b, 0x1e, 0xbf, 0x71, 0x2e, 0xb8, 0x2c, 0xf0, 0xcc, 
+    0xb0, 0x99, 0x4e, 0xcd, 0x13, 0x87, 0x89, 0xc5, 0x42, 0x1b, 0x2b, 0x6d, 
+    0xcc, 0x8a, 0xa6, 0x46, 0x3c, 0x4d, 0x1c, 0x51, 0x35, 0x9d, 0xf2, 0x85, 
+    0x8c, 0xc7, 0x2a, 0xe7, 0x2d, 0xce, 0x5a, 0xb9, 0xca, 0x9a, 0xf7, 0xe4, 
+    0x2f, 0x0c, 0xe5, 0xf4, 0x95, 0x65, 0xae, 0xd3, 0x1a, 0x41, 0x02, 0x8b, 
+    0x58, 0x82, 0x04, 0x11, 0x0a, 0xaa, 0x28, 0xa1, 0x0c, 0x1b, 0x51, 0xda, 
+    0x75, 0x52, 0x2c, 0xa4, 0xe8, 0x3c, 0xde, 0xc1, 0x3f, 0xe4, 0xfa, 0x25, 
+    0x72, 0x29, 0xe4, 0x2a, 0x81, 0x91, 0x63, 0x01, 0x15, 0x68, 0x90, 0x5d, 
+    0x3f, 0xf8, 0x1f, 0xfc, 0x9e, 0xad, 0x95, 0x9f, 0x9a, 0xf4, 0x92, 0x42, 
+    0x71, 0x20, 0xf0, 0xe2, 0x38, 0x1f, 0x63, 0x40, 0x70, 0x17, 0x68, 0xd4, 
+    0x1c, 0xe7, 0xfb, 0xd8, 0x71, 0x1a, 0x27, 0x80, 0xff, 0x19, 0xb8, 0xd2, 
+    0x5b, 0xfe, 0x4a, 0x1d, 0x98, 0xfd, 0x24, 0xbd, 0xd6, 0xd2, 0x22, 0x47, 
+    0x40, 0xff, 0x36, 0x70, 0x71, 0xdd, 0xd2, 0x94, 0x3d, 0xe0, 0x72, 0x07, 
+    0x18, 0x7c, 0x32, 0x64, 0x53, 0x76, 0x25, 0x3f, 0x2d, 0x21, 0x9f, 0x07, 
+    0xde, 0xcf, 0xe8, 0x9b, 0xb2, 0xc0, 0xc0, 0x2d, 0xd0, 0xbb, 0xe6, 0xcd, 
+    0xad, 0x79, 0x8e, 0xd3, 0x07, 0x20, 0x4d, 0xb3, 0x4a, 0xde, 0x00, 0x07, 
+    0x87, 0xc0, 0x78, 0x81, 0xb2, 0xd7, 0x3b, 0xbc, 0xbb, 0xa7, 0x7d, 0x6e, 
+    0xff, 0xf6, 0x34, 0xe7, 0xf7, 0x03, 0x44, 0xe2, 0x72, 0x94, 0xa3, 0x98, 
+    0x6e, 0x72, 0x00, 0x00, 0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 
+    0x2e, 0x23, 0x00, 0x00, 0x2e, 0x23, 0x01, 0x78, 0xa5, 0x3f, 0x76, 0x00, 
+    0x00, 0x00, 0x07, 0x74, 0x49, 0x4d, 0x45, 0x07, 0xe7, 0x05, 0x06, 0x01, 
+    0x22, 0x2f, 0x27, 0xbf, 0x40, 0x78, 0x00, 0x00, 0x00, 0x19, 0x74, 0x45, 
+    0x58, 0x74, 0x43, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0x43, 0x72, 
+    0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x47, 
+    0x49, 0x4d, 0x50, 0x57, 0x81, 0x0e, 0x17, 0x00, 0x00, 0x00, 0x36, 0x49, 
+    0x44, 0x41, 0x54, 0x28, 0xcf, 0x63, 0x8c, 0x8d, 0x8a, 0x63, 0x20, 0x1a, 
+    0x7c, 0xff, 0xfe, 0x9d, 0x85, 0x81, 0x81, 0x41, 0x50, 0x40, 0x90, 0x48, 
+    0x0d, 0x6f, 0xde, 0xbe, 0x61, 0x62, 0x20, 0x11, 0x8c, 0x6a, 0x18, 0xd5, 
+    0x40, 0x2d, 0x0d, 0x2c, 0xdf, 0xbf, 0x7f, 0x7f, 0xfb, 0xee, 0x2d, 0x91, 
+    0xaa, 0x19, 0x19, 0x19, 0x01, 0xe1, 0x3b, 0x0c, 0xc5, 0xd9, 0xd7, 0x5a, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 
+    0x82
+};
+
+/* tile_open.png */
+const unsigned char data_tile_open_png[560] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 
+    0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x90, 0x91, 0x68, 0x36, 0x00, 0x00, 0x01, 
+    0x85, 0x69, 0x43, 0x43, 0x50, 0x49, 0x43, 0x43, 0x20, 0x70, 0x72, 0x6f, 
+    0x66, 0x69, 0x6c, 0x65, 0x00, 0x00, 0x28, 0x91, 0x7d, 0x91, 0x3b, 0x48, 
+    0xc3, 0x50, 0x14, 0x86, 0xff, 0xa6, 0xd6, 0x8a, 0x54, 0x1c, 0xec, 0x20, 
+    0x3e, 0x20, 0x43, 0x75, 0xb2, 0x8b, 0x8a, 0x38, 0xd6, 0x2a, 0x14, 0xa1, 
+    0x42, 0xa8, 0x15, 0x5a, 0x75, 0x30, 0xb9, 0xe9, 0x0b, 0x9a, 0x34, 0x24, 
+    0x29, 0x2e, 0x8e, 0x82, 0x6b, 0xc1, 0xc1, 0xc7, 0x62, 0xd5, 0xc1, 0xc5, 
+    0x59, 0x57, 0x07, 0x57, 0x41, 0x10, 0x7c, 0x80, 0xb8, 0xba, 0x38, 0x29, 
+    0xba, 0x48, 0x89, 0xe7, 0x26, 0x85, 0x16, 0xb1, 0x1e, 0xb8, 0xdc, 0x8f, 
+    0xff, 0x9e, 0xff, 0xe7, 0xde, 0x73, 0x01, 0xa1, 0x5e, 0x66, 0x9a, 0xd5, 
+    0x15, 0x03, 0x34, 0xdd, 0x36, 0x53, 0x89, 0xb8, 0x98, 0xc9, 0xae, 0x8a, 
+    0xc1, 0x57, 0x04, 0xd0, 0x0d, 0x1f, 0x46, 0x31, 0x2c, 0x33, 0xcb, 0x98, 
+    0x93, 0xa4, 0x24, 0x3a, 0xd6, 0xd7, 0x3d, 0x75, 0x52, 0xdd, 0x45, 0x79, 
+    0x56, 0xe7, 0xbe, 0x3f, 0xab, 0x4f, 0xcd, 0x59, 0x0c, 0xf0, 0x89, 0xc4, 
+    0x31, 0x66, 0x98, 0x36, 0xf1, 0x06, 0xf1, 0xcc, 0xa6, 0x6d, 0x70, 0xde, 
+    0x27, 0x0e, 0xb3, 0xa2, 0xac, 0x12, 0x9f, 0x13, 0x4f, 0x98, 0x74, 0x41, 
+    0xe2, 0x47, 0xae, 0x2b, 0x1e, 0xbf, 0x71, 0x2e, 0xb8, 0x2c, 0xf0, 0xcc, 
+    0xb0, 0x99, 0x4e, 0xcd, 0x13, 0x87, 0x89, 0xc5, 0x42, 0x1b, 0x2b, 0x6d, 
+    0xcc, 0x8a, 0xa6, 0x46, 0x3c, 0x4d, 0x1c, 0x51, 0x35, 0x9d, 0xf2, 0x85, 
+    0x8c, 0xc7, 0x2a, 0xe7, 0x2d, 0xce, 0x5a, 0xb9, 0xca, 0x9a, 0xf7, 0xe4, 
+    0x2f, 0x0c, 0xe5, 0xf4, 0x95, 0x65, 0xae, 0xd3, 0x1a, 0x41, 0x02, 0x8b, 
+    0x58, 0x82, 0x04, 0x11, 0x0a, 0xaa, 0x28, 0xa1, 0x0c, 0x1b, 0x51, 0xda, 
+    0x75, 0x52, 0x2c, 0xa4, 0xe8, 0x3c, 0xde, 0xc1, 0x3f, 0xe4, 0xfa, 0x25, 
+    0x72, 0x29, 0xe4, 0x2a, 0x81, 0x91, 0x63, 0x01, 0x15, 0x68, 0x90, 0x5d, 
+    0x3f, 0xf8, 0x1f, 0xfc, 0x9e, 0xad, 0x95, 0x9f, 0x9a, 0xf4, 0x92, 0x42, 
+    0x71, 0x20, 0xf0, 0xe2, 0x38, 0x1f, 0x63, 0x40, 0x70, 0x17, 0x68, 0xd4, 
+    0x1c, 0xe7, 0xfb, 0xd8, 0x71, 0x1a, 0x27, 0x80, 0xff, 0x19, 0xb8, 0xd2, 
+    0x5b, 0xfe, 0x4a, 0x1d, 0x98, 0xfd, 0x24, 0xbd, 0xd6, 0xd2, 0x22, 0x47, 
+    0x40, 0xff, 0x36, 0x70, 0x71, 0xdd, 0xd2, 0x94, 0x3d, 0xe0, 0x72, 0x07, 
+    0x18, 0x7c, 0x32, 0x64, 0x53, 0x76, 0x25, 0x3f, 0x2d, 0x21, 0x9f, 0x07, 
+    0xde, 0xcf, 0xe8, 0x9b, 0xb2, 0xc0, 0xc0, 0x2d, 0xd0, 0xbb, 0xe6, 0xcd, 
+    0xad, 0x79, 0x8e, 0xd3, 0x07, 0x20, 0x4d, 0xb3, 0x4a, 0xde, 0x00, 0x07, 
+    0x87, 0xc0, 0x78, 0x81, 0xb2, 0xd7, 0x3b, 0xbc, 0xbb, 0xa7, 0x7d, 0x6e, 
+    0xff, 0xf6, 0x34, 0xe7, 0xf7, 0x03, 0x44, 0xe2, 0x72, 0x94, 0xa3, 0x98, 
+    0x6e, 0x72, 0x00, 0x00, 0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 
+    0x2e, 0x23, 0x00, 0x00, 0x2e, 0x23, 0x01, 0x78, 0xa5, 0x3f, 0x76, 0x00, 
+    0x00, 0x00, 0x07, 0x74, 0x49, 0x4d, 0x45, 0x07, 0xe7, 0x05, 0x06, 0x01, 
+    0x23, 0x29, 0xd7, 0xc7, 0xd4, 0x0c, 0x00, 0x00, 0x00, 0x19, 0x74, 0x45, 
+    0x58, 0x74, 0x43, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0x43, 0x72, 
+    0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x47, 
+    0x49, 0x4d, 0x50, 0x57, 0x81, 0x0e, 0x17, 0x00, 0x00, 0x00, 0x19, 0x49, 
+    0x44, 0x41, 0x54, 0x28, 0xcf, 0x63, 0x6c, 0x6b, 0x6a, 0x67, 0x20, 0x05, 
+    0x30, 0x31, 0x90, 0x08, 0x46, 0x35, 0x8c, 0x6a, 0x18, 0x3a, 0x1a, 0x00, 
+    0xf7, 0x1d, 0x01, 0xaf, 0x85, 0x2b, 0x01, 0x92, 0x00, 0x00, 0x00, 0x00, 
+    0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
+};
+
+/* mine.png */
+const unsigned char data_mine_png[865] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 
+    0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 
+    0x08, 0x06, 0x00, 0x00, 0x00, 0x1f, 0xf3, 0xff, 0x61, 0x00, 0x00, 0x01, 
+    0x84, 0x69, 0x43, 0x43, 0x50, 0x49, 0x43, 0x43, 0x20, 0x70, 0x72, 0x6f, 
+    0x66, 0x69, 0x6c, 0x65, 0x00, 0x00, 0x28, 0x91, 0x7d, 0x91, 0x3d, 0x48, 
+    0xc3, 0x40, 0x1c, 0xc5, 0x5f, 0xd3, 0xd6, 0x16, 0xa9, 0x38, 0xd8, 0x41, 
+    0xc4, 0x21, 0x43, 0x75, 0x10, 0xbb, 0xa8, 0x88, 0xa3, 0x56, 0xa1, 0x08, 
+    0x15, 0x42, 0xad, 0xd0, 0xaa, 0x83, 0xc9, 0xa5, 0x5f, 0xd0, 0xa4, 0x21, 
+    0x49, 0x71, 0x71, 0x14, 0x5c, 0x0b, 0x0e, 0x7e, 0x2c, 0x56, 0x1d, 0x5c, 
+    0x9c, 0x75, 0x75, 0x70, 0x15, 0x04, 0xc1, 0x0f, 0x10, 0x57, 0x17, 0x27, 
+    0x45, 0x17, 0x29, 0xf1, 0x7f, 0x69, 0xa1, 0x45, 0x8c, 0x07, 0xc7, 0xfd, 
+    0x78, 0x77, 0xef, 0x71, 0xf7, 0x0e, 0x10, 0x1a, 0x15, 0xa6, 0x59, 0x81, 
+    0x59, 0x40, 0xd3, 0x6d, 0x33, 0x9d, 0x4c, 0x88, 0xd9, 0xdc, 0xaa, 0x18, 
+    0x7a, 0x45, 0x10, 0x3d, 0x08, 0x60, 0x0c, 0x61, 0x99, 0x59, 0xc6, 0x9c, 
+    0x24, 0xa5, 0xe0, 0x39, 0xbe, 0xee, 0xe1, 0xe3, 0xeb, 0x5d, 0x9c, 0x67, 
+    0x79, 0x9f, 0xfb, 0x73, 0xf4, 0xa9, 0x79, 0x8b, 0x01, 0x3e, 0x91, 0x78, 
+    0x96, 0x19, 0xa6, 0x4d, 0xbc, 0x41, 0x3c, 0xbd, 0x69, 0x1b, 0x9c, 0xf7, 
+    0x89, 0xa3, 0xac, 0x24, 0xab, 0xc4, 0xe7, 0xc4, 0xe3, 0x26, 0x5d, 0x90, 
+    0xf8, 0x91, 0xeb, 0x4a, 0x8b, 0xdf, 0x38, 0x17, 0x5d, 0x16, 0x78, 0x66, 
+    0xd4, 0xcc, 0xa4, 0xe7, 0x89, 0xa3, 0xc4, 0x62, 0xb1, 0x8b, 0x95, 0x2e, 
+    0x66, 0x25, 0x53, 0x23, 0x9e, 0x22, 0x8e, 0xa9, 0x9a, 0x4e, 0xf9, 0x42, 
+    0xb6, 0xc5, 0x2a, 0xe7, 0x2d, 0xce, 0x5a, 0xa5, 0xc6, 0xda, 0xf7, 0xe4, 
+    0x2f, 0x8c, 0xe4, 0xf5, 0x95, 0x65, 0xae, 0xd3, 0x1c, 0x46, 0x12, 0x8b, 
+    0x58, 0x82, 0x04, 0x11, 0x0a, 0x6a, 0x28, 0xa3, 0x02, 0x1b, 0x71, 0x5a, 
+    0x75, 0x52, 0x2c, 0xa4, 0x69, 0x3f, 0xe1, 0xe1, 0x1f, 0x72, 0xfd, 0x12, 
+    0xb9, 0x14, 0x72, 0x95, 0xc1, 0xc8, 0xb1, 0x80, 0x2a, 0x34, 0xc8, 0xae, 
+    0x1f, 0xfc, 0x0f, 0x7e, 0x77, 0x6b, 0x15, 0x26, 0x27, 0x5a, 0x49, 0x91, 
+    0x04, 0x10, 0x7c, 0x71, 0x9c, 0x8f, 0x11, 0x20, 0xb4, 0x0b, 0x34, 0xeb, 
+    0x8e, 0xf3, 0x7d, 0xec, 0x38, 0xcd, 0x13, 0xc0, 0xff, 0x0c, 0x5c, 0xe9, 
+    0x1d, 0x7f, 0xb5, 0x01, 0xcc, 0x7c, 0x92, 0x5e, 0xef, 0x68, 0xb1, 0x23, 
+    0xa0, 0x7f, 0x1b, 0xb8, 0xb8, 0xee, 0x68, 0xca, 0x1e, 0x70, 0xb9, 0x03, 
+    0x0c, 0x3e, 0x19, 0xb2, 0x29, 0xbb, 0x92, 0x9f, 0xa6, 0x50, 0x28, 0x00, 
+    0xef, 0x67, 0xf4, 0x4d, 0x39, 0x60, 0xe0, 0x16, 0xe8, 0x5d, 0x6b, 0xf5, 
+    0xd6, 0xde, 0xc7, 0xe9, 0x03, 0x90, 0xa1, 0xae, 0x52, 0x37, 0xc0, 0xc1, 
+    0x21, 0x30, 0x5a, 0xa4, 0xec, 0x75, 0x8f, 0x77, 0x87, 0xbb, 0x7b, 0xfb, 
+    0xf7, 0x4c, 0xbb, 0xbf, 0x1f, 0x3d, 0x91, 0x72, 0x91, 0x72, 0x30, 0x79, 
+    0x20, 0x00, 0x00, 0x00, 0x06, 0x62, 0x4b, 0x47, 0x44, 0x00, 0xff, 0x00, 
+    0xff, 0x00, 0xff, 0xa0, 0xbd, 0xa7, 0x93, 0x00, 0x00, 0x00, 0x09, 0x70, 
+    0x48, 0x59, 0x73, 0x00, 0x00, 0x2e, 0x23, 0x00, 0x00, 0x2e, 0x23, 0x01, 
+    0x78, 0xa5, 0x3f, 0x76, 0x00, 0x00, 0x00, 0x07, 0x74, 0x49, 0x4d, 0x45, 
+    0x07, 0xe7, 0x05, 0x06, 0x04, 0x31, 0x2d, 0xae, 0x95, 0xa2, 0x2d, 0x00, 
+    0x00, 0x00, 0x19, 0x74, 0x45, 0x58, 0x74, 0x43, 0x6f, 0x6d, 0x6d, 0x65, 
+    0x6e, 0x74, 0x00, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 
+    0x69, 0x74, 0x68, 0x20, 0x47, 0x49, 0x4d, 0x50, 0x57, 0x81, 0x0e, 0x17, 
+    0x00, 0x00, 0x01, 0x39, 0x49, 0x44, 0x41, 0x54, 0x38, 0xcb, 0xb5, 0x93, 
+    0xbf, 0x2f, 0x04, 0x41, 0x14, 0xc7, 0x3f, 0xf6, 0x2e, 0x27, 0x91, 0xbb, 
+    0xac, 0xa8, 0x10, 0x15, 0xd5, 0x14, 0x33, 0xd1, 0x20, 0x68, 0xd6, 0x9f, 
+    0xe1, 0x5f, 0xd0, 0xd2, 0x5d, 0x61, 0x15, 0x3a, 0xfe, 0x03, 0x9d, 0x44, 
+    0xae, 0x53, 0x89, 0xe2, 0x0a, 0x57, 0xa9, 0xae, 0x70, 0x33, 0xc5, 0xe8, 
+    0x14, 0x24, 0xaa, 0x4b, 0x6e, 0xe3, 0xd8, 0x38, 0x36, 0x51, 0x18, 0xb2, 
+    0x36, 0x73, 0x72, 0x88, 0x57, 0xcd, 0x9b, 0xf7, 0x7d, 0xdf, 0xf7, 0x1b, 
+    0xfe, 0x43, 0xa4, 0x12, 0x1d, 0xa9, 0xc4, 0x62, 0x4e, 0xaf, 0x4b, 0x25, 
+    0x9a, 0x3e, 0x6c, 0xd9, 0x01, 0x76, 0x00, 0x8c, 0xb6, 0x07, 0xee, 0xff, 
+    0x11, 0x38, 0x92, 0x4a, 0x24, 0x4e, 0x0f, 0x81, 0x53, 0x87, 0x3d, 0x01, 
+    0xce, 0x8d, 0xb6, 0xc7, 0x00, 0x63, 0xb9, 0x28, 0xf7, 0xee, 0xb9, 0x09, 
+    0xec, 0x02, 0x51, 0x21, 0x58, 0x0b, 0xb8, 0x06, 0x16, 0x80, 0x4b, 0xa3, 
+    0x6d, 0xfc, 0x85, 0xc0, 0x91, 0x74, 0x81, 0xa9, 0x30, 0x9c, 0x04, 0x60, 
+    0x30, 0x78, 0x26, 0x4d, 0xd3, 0x62, 0xd6, 0x6d, 0xa3, 0xed, 0xd2, 0x87, 
+    0x12, 0x14, 0x8c, 0xba, 0x52, 0x19, 0x67, 0x66, 0x7a, 0x96, 0x95, 0xe5, 
+    0x55, 0x6a, 0xb5, 0xd0, 0x57, 0x76, 0x3f, 0xaf, 0x04, 0xb9, 0xe8, 0x91, 
+    0x27, 0x6d, 0x9f, 0x44, 0x0e, 0xcb, 0x67, 0x09, 0x52, 0x89, 0x27, 0xa0, 
+    0x0b, 0xcc, 0x95, 0x4a, 0x65, 0xaa, 0xd5, 0x2a, 0x00, 0x59, 0x96, 0xd1, 
+    0xef, 0x3f, 0xf8, 0x48, 0xee, 0x80, 0x5b, 0xa3, 0xed, 0x5a, 0xe0, 0xba, 
+    0x3f, 0x01, 0x9c, 0xbd, 0x3b, 0xbd, 0x92, 0x24, 0x3d, 0x92, 0xa4, 0x37, 
+    0xcc, 0x19, 0x87, 0xdd, 0x2a, 0xf6, 0xa0, 0xf1, 0x83, 0x55, 0x69, 0x18, 
+    0x6d, 0xaf, 0x7c, 0x53, 0xb8, 0x18, 0xa1, 0x0f, 0x37, 0x46, 0xdb, 0xf9, 
+    0x61, 0x53, 0xd8, 0x1b, 0x21, 0x7a, 0x47, 0x2a, 0x51, 0x1f, 0x46, 0xb0, 
+    0x0e, 0xbc, 0xb8, 0xa5, 0xc1, 0xb3, 0x48, 0x1b, 0x40, 0x3b, 0x9f, 0x65, 
+    0xb1, 0x84, 0x26, 0xd0, 0x32, 0xda, 0xee, 0xbb, 0x51, 0x6d, 0x3b, 0xd3, 
+    0xa1, 0xd1, 0xb6, 0xf5, 0x9b, 0xa3, 0x8a, 0xa5, 0x12, 0xf1, 0x77, 0x98, 
+    0xe0, 0xaf, 0x97, 0xfb, 0x06, 0x42, 0x8d, 0x61, 0xe5, 0xdd, 0xe4, 0xf0, 
+    0xc7, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 
+    0x82
+};
+
+/* mine_flagged.png */
+const unsigned char data_mine_flagged_png[972] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 
+    0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 
+    0x08, 0x06, 0x00, 0x00, 0x00, 0x1f, 0xf3, 0xff, 0x61, 0x00, 0x00, 0x01, 
+    0x84, 0x69, 0x43, 0x43, 0x50, 0x49, 0x43, 0x43, 0x20, 0x70, 0x72, 0x6f, 
+    0x66, 0x69, 0x6c, 0x65, 0x00, 0x00, 0x28, 0x91, 0x7d, 0x91, 0x3d, 0x48, 
+    0xc3, 0x40, 0x1c, 0xc5, 0x5f, 0xd3, 0xd6, 0x16, 0xa9, 0x38, 0xd8, 0x41, 
+    0xc4, 0x21, 0x43, 0x75, 0x10, 0xbb, 0xa8, 0x88, 0xa3, 0x56, 0xa1, 0x08, 
+    0x15, 0x42, 0xad, 0xd0, 0xaa, 0x83, 0xc9, 0xa5, 0x5f, 0xd0, 0xa4, 0x21, 
+    0x49, 0x71, 0x71, 0x14, 0x5c, 0x0b, 0x0e, 0x7e, 0x2c, 0x56, 0x1d, 0x5c, 
+    0x9c, 0x75, 0x75, 0x70, 0x15, 0x04, 0xc1, 0x0f, 0x10, 0x57, 0x17, 0x27, 
+    0x45, 0x17, 0x29, 0xf1, 0x7f, 0x69, 0xa1, 0x45, 0x8c, 0x07, 0xc7, 0xfd, 
+    0x78, 0x77, 0xef, 0x71, 0xf7, 0x0e, 0x10, 0x1a, 0x15, 0xa6, 0x59, 0x81, 
+    0x59, 0x40, 0xd3, 0x6d, 0x33, 0x9d, 0x4c, 0x88, 0xd9, 0xdc, 0xaa, 0x18, 
+    0x7a, 0x45, 0x10, 0x3d, 0x08, 0x60, 0x0c, 0x61, 0x99, 0x59, 0xc6, 0x9c, 
+    0x24, 0xa5, 0xe0, 0x39, 0xbe, 0xee, 0xe1, 0xe3, 0xeb, 0x5d, 0x9c, 0x67, 
+    0x79, 0x9f, 0xfb, 0x73, 0xf4, 0xa9, 0x79, 0x8b, 0x01, 0x3e, 0x91, 0x78, 
+    0x96, 0x19, 0xa6, 0x4d, 0xbc, 0x41, 0x3c, 0xbd, 0x69, 0x1b, 0x9c, 0xf7, 
+    0x89, 0xa3, 0xac, 0x24, 0xab, 0xc4, 0xe7, 0xc4, 0xe3, 0x26, 0x5d, 0x90, 
+    0xf8, 0x91, 0xeb, 0x4a, 0x8b, 0xdf, 0x38, 0x17, 0x5d, 0x16, 0x78, 0x66, 
+    0xd4, 0xcc, 0xa4, 0xe7, 0x89, 0xa3, 0xc4, 0x62, 0xb1, 0x8b, 0x95, 0x2e, 
+    0x66, 0x25, 0x53, 0x23, 0x9e, 0x22, 0x8e, 0xa9, 0x9a, 0x4e, 0xf9, 0x42, 
+    0xb6, 0xc5, 0x2a, 0xe7, 0x2d, 0xce, 0x5a, 0xa5, 0xc6, 0xda, 0xf7, 0xe4, 
+    0x2f, 0x8c, 0xe4, 0xf5, 0x95, 0x65, 0xae, 0xd3, 0x1c, 0x46, 0x12, 0x8b, 
+    0x58, 0x82, 0x04, 0x11, 0x0a, 0x6a, 0x28, 0xa3, 0x02, 0x1b, 0x71, 0x5a, 
+    0x75, 0x52, 0x2c, 0xa4, 0x69, 0x3f, 0xe1, 0xe1, 0x1f, 0x72, 0xfd, 0x12, 
+    0xb9, 0x14, 0x72, 0x95, 0xc1, 0xc8, 0xb1, 0x80, 0x2a, 0x34, 0xc8, 0xae, 
+    0x1f, 0xfc, 0x0f, 0x7e, 0x77, 0x6b, 0x15, 0x26, 0x27, 0x5a, 0x49, 0x91, 
+    0x04, 0x10, 0x7c, 0x71, 0x9c, 0x8f, 0x11, 0x20, 0xb4, 0x0b, 0x34, 0xeb, 
+    0x8e, 0xf3, 0x7d, 0xec, 0x38, 0xcd, 0x13, 0xc0, 0xff, 0x0c, 0x5c, 0xe9, 
+    0x1d, 0x7f, 0xb5, 0x01, 0xcc, 0x7c, 0x92, 0x5e, 0xef, 0x68, 0xb1, 0x23, 
+    0xa0, 0x7f, 0x1b, 0xb8, 0xb8, 0xee, 0x68, 0xca, 0x1e, 0x70, 0xb9, 0x03, 
+    0x0c, 0x3e, 0x19, 0xb2, 0x29, 0xbb, 0x92, 0x9f, 0xa6, 0x50, 0x28, 0x00, 
+    0xef, 0x67, 0xf4, 0x4d, 0x39, 0x60, 0xe0, 0x16, 0xe8, 0x5d, 0x6b, 0xf5, 
+    0xd6, 0xde, 0xc7, 0xe9, 0x03, 0x90, 0xa1, 0xae, 0x52, 0x37, 0xc0, 0xc1, 
+    0x21, 0x30, 0x5a, 0xa4, 0xec, 0x75, 0x8f, 0x77, 0x87, 0xbb, 0x7b, 0xfb, 
+    0xf7, 0x4c, 0xbb, 0xbf, 0x1f, 0x3d, 0x91, 0x72, 0x91, 0x72, 0x30, 0x79, 
+    0x20, 0x00, 0x00, 0x00, 0x06, 0x62, 0x4b, 0x47, 0x44, 0x00, 0xd0, 0x00, 
+    0x00, 0x00, 0x00, 0x70, 0xb6, 0xc4, 0x26, 0x00, 0x00, 0x00, 0x09, 0x70, 
+    0x48, 0x59, 0x73, 0x00, 0x00, 0x2e, 0x23, 0x00, 0x00, 0x2e, 0x23, 0x01, 
+    0x78, 0xa5, 0x3f, 0x76, 0x00, 0x00, 0x00, 0x07, 0x74, 0x49, 0x4d, 0x45, 
+    0x07, 0xe7, 0x05, 0x06, 0x04, 0x37, 0x0e, 0x5a, 0xa8, 0x74, 0xd9, 0x00, 
+    0x00, 0x00, 0x19, 0x74, 0x45, 0x58, 0x74, 0x43, 0x6f, 0x6d, 0x6d, 0x65, 
+    0x6e, 0x74, 0x00, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 
+    0x69, 0x74, 0x68, 0x20, 0x47, 0x49, 0x4d, 0x50, 0x57, 0x81, 0x0e, 0x17, 
+    0x00, 0x00, 0x01, 0xa4, 0x49, 0x44, 0x41, 0x54, 0x38, 0xcb, 0xa5, 0x92, 
+    0xb1, 0x4e, 0xdb, 0x50, 0x14, 0x86, 0xbf, 0x5c, 0xc7, 0x09, 0x89, 0x9c, 
+    0xa6, 0xa2, 0x69, 0x28, 0xa8, 0x4b, 0x2b, 0x3a, 0x78, 0xb0, 0x41, 0x8a, 
+    0x54, 0x04, 0x0c, 0xa5, 0x7b, 0x77, 0xc4, 0x2b, 0xb0, 0x96, 0x8d, 0xa1, 
+    0x61, 0x60, 0x6a, 0xfb, 0x06, 0x3c, 0x00, 0x2f, 0x50, 0x96, 0x4a, 0x34, 
+    0x73, 0xd5, 0x81, 0xd8, 0x83, 0xd9, 0x68, 0x81, 0x28, 0x21, 0xaa, 0x55, 
+    0x9c, 0xa4, 0x09, 0xb1, 0x6b, 0xc4, 0x90, 0x6b, 0xc9, 0xb1, 0x52, 0xd4, 
+    0xa8, 0xff, 0x74, 0xcf, 0xfd, 0xcf, 0xb9, 0xe7, 0xff, 0xcf, 0xb9, 0x0a, 
+    0xd3, 0xe1, 0x07, 0x50, 0x02, 0x8e, 0xef, 0xcd, 0x32, 0x4c, 0xbd, 0x6e, 
+    0x98, 0xfa, 0x72, 0x2c, 0xde, 0x5d, 0x7c, 0xf1, 0xec, 0x74, 0x13, 0x7e, 
+    0xbd, 0x82, 0x0e, 0x50, 0x8d, 0xb8, 0xb4, 0x4c, 0xd8, 0x01, 0xb0, 0x2d, 
+    0xe7, 0x83, 0xbc, 0xff, 0x0d, 0x1c, 0x18, 0xa6, 0xee, 0xc9, 0xb8, 0xe8, 
+    0xbb, 0xee, 0x6d, 0x05, 0x72, 0x3f, 0xcb, 0xb3, 0xd9, 0xaf, 0xbd, 0xfe, 
+    0xe6, 0xa0, 0x7f, 0x53, 0x05, 0x48, 0xc5, 0xba, 0x34, 0xe5, 0x71, 0x0b, 
+    0x78, 0x07, 0x6c, 0x44, 0x5c, 0x10, 0x04, 0x2c, 0x9d, 0x37, 0xea, 0x5b, 
+    0x05, 0xcd, 0xf8, 0x9e, 0xcf, 0x89, 0x46, 0xa3, 0xc5, 0xfb, 0xa1, 0x0f, 
+    0x90, 0x4a, 0x25, 0xa4, 0xbb, 0xc0, 0x6c, 0xb1, 0xf8, 0x10, 0x00, 0xdf, 
+    0x1f, 0x32, 0x18, 0x0c, 0xb8, 0x6a, 0xb5, 0xc9, 0x41, 0x5f, 0xf3, 0x03, 
+    0x75, 0x26, 0xbc, 0xf5, 0xe7, 0xba, 0xbd, 0xce, 0x11, 0x34, 0x81, 0x8a, 
+    0x48, 0xd8, 0xb7, 0x32, 0x99, 0x2c, 0xf3, 0x4f, 0x16, 0x58, 0x79, 0xb9, 
+    0x4a, 0xa1, 0x50, 0x04, 0xa0, 0xdd, 0x76, 0xd1, 0x1e, 0x97, 0xf2, 0xe1, 
+    0x7c, 0x59, 0xed, 0x2e, 0xcc, 0x9d, 0x1e, 0xc1, 0x1b, 0xa0, 0x02, 0x20, 
+    0x62, 0xdd, 0x37, 0xe2, 0xb2, 0x23, 0x5c, 0xb5, 0xda, 0x94, 0xcb, 0x8f, 
+    0x10, 0x8a, 0x40, 0x55, 0x55, 0xb2, 0xd9, 0x4c, 0xc5, 0x30, 0xf5, 0x07, 
+    0x11, 0x9f, 0x92, 0xc5, 0x7d, 0xc0, 0x05, 0x9e, 0x2a, 0x4a, 0x1a, 0x4d, 
+    0xd3, 0x00, 0x08, 0xc3, 0x90, 0x8e, 0x37, 0x9a, 0xa3, 0x50, 0xc6, 0xc4, 
+    0x5e, 0x02, 0x17, 0xb6, 0xe5, 0xac, 0x09, 0x39, 0xfd, 0x3c, 0xf0, 0x69, 
+    0x54, 0xf4, 0x07, 0xcf, 0xbb, 0xc6, 0xf3, 0xae, 0xe9, 0xf5, 0xba, 0x08, 
+    0x45, 0x24, 0x8b, 0x91, 0xb9, 0xdb, 0x63, 0x16, 0x80, 0xc3, 0x29, 0x3e, 
+    0xd4, 0xa1, 0x6d, 0x39, 0x27, 0x63, 0x6b, 0x94, 0x56, 0xbe, 0x4c, 0x9a, 
+    0x43, 0x02, 0x67, 0xb6, 0xe5, 0x3c, 0x8f, 0x82, 0xa4, 0xb6, 0xbd, 0x7f, 
+    0xe8, 0x5e, 0x37, 0x4c, 0x7d, 0xf7, 0x6f, 0x0f, 0xac, 0x03, 0x01, 0x50, 
+    0x9b, 0x50, 0x58, 0x03, 0x5e, 0x03, 0xdf, 0xe2, 0x2a, 0x93, 0x16, 0x3e, 
+    0x03, 0x35, 0xdb, 0x72, 0xf6, 0xe5, 0x5a, 0xdf, 0x4a, 0xea, 0xa3, 0x6d, 
+    0x39, 0x35, 0xa6, 0x85, 0x61, 0xea, 0x55, 0xc3, 0xd4, 0xab, 0xf7, 0xe5, 
+    0x08, 0xfe, 0x13, 0x77, 0x0b, 0x12, 0x86, 0xe0, 0x22, 0xb5, 0x15, 0x9f, 
+    0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
+};
+
+/* flag.png */
+const unsigned char data_flag_png[767] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 
+    0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 
+    0x08, 0x06, 0x00, 0x00, 0x00, 0x1f, 0xf3, 0xff, 0x61, 0x00, 0x00, 0x01, 
+    0x85, 0x69, 0x43, 0x43, 0x50, 0x49, 0x43, 0x43, 0x20, 0x70, 0x72, 0x6f, 
+    0x66, 0x69, 0x6c, 0x65, 0x00, 0x00, 0x28, 0x91, 0x7d, 0x91, 0x3b, 0x48, 
+    0xc3, 0x50, 0x14, 0x86, 0xff, 0xa6, 0xd6, 0x8a, 0x54, 0x1c, 0xec, 0x20, 
+    0x3e, 0x20, 0x43, 0x75, 0xb2, 0x8b, 0x8a, 0x38, 0xd6, 0x2a, 0x14, 0xa1, 
+    0x42, 0xa8, 0x15, 0x5a, 0x75, 0x30, 0xb9, 0xe9, 0x0b, 0x9a, 0x34, 0x24, 
+    0x29, 0x2e, 0x8e, 0x82, 0x6b, 0xc1, 0xc1, 0xc7, 0x62, 0xd5, 0xc1, 0xc5, 
+    0x59, 0x57, 0x07, 0x57, 0x41, 0x10, 0x7c, 0x80, 0xb8, 0xba, 0x38, 0x29, 
+    0xba, 0x48, 0x89, 0xe7, 0x26, 0x85, 0x16, 0xb1, 0x1e, 0xb8, 0xdc, 0x8f, 
+    0xff, 0x9e, 0xff, 0xe7, 0xde, 0x73, 0x01, 0xa1, 0x5e, 0x66, 0x9a, 0xd5, 
+    0x15, 0x03, 0x34, 0xdd, 0x36, 0x53, 0x89, 0xb8, 0x98, 0xc9, 0xae, 0x8a, 
+    0xc1, 0x57, 0x04, 0xd0, 0x0d, 0x1f, 0x46, 0x31, 0x2c, 0x33, 0xcb, 0x98, 
+    0x93, 0xa4, 0x24, 0x3a, 0xd6, 0xd7, 0x3d, 0x75, 0x52, 0xdd, 0x45, 0x79, 
+    0x56, 0xe7, 0xbe, 0x3f, 0xab, 0x4f, 0xcd, 0x59, 0x0c, 0xf0, 0x89, 0xc4, 
+    0x31, 0x66, 0x98, 0x36, 0xf1, 0x06, 0xf1, 0xcc, 0xa6, 0x6d, 0x70, 0xde, 
+    0x27, 0x0e, 0xb3, 0xa2, 0xac, 0x12, 0x9f, 0x13, 0x4f, 0x98, 0x74, 0x41, 
+    0xe2, 0x47, 0xae, 0x2b, 0x1e, 0xbf, 0x71, 0x2e, 0xb8, 0x2c, 0xf0, 0xcc, 
+    0xb0, 0x99, 0x4e, 0xcd, 0x13, 0x87, 0x89, 0xc5, 0x42, 0x1b, 0x2b, 0x6d, 
+    0xcc, 0x8a, 0xa6, 0x46, 0x3c, 0x4d, 0x1c, 0x51, 0x35, 0x9d, 0xf2, 0x85, 
+    0x8c, 0xc7, 0x2a, 0xe7, 0x2d, 0xce, 0x5a, 0xb9, 0xca, 0x9a, 0xf7, 0xe4, 
+    0x2f, 0x0c, 0xe5, 0xf4, 0x95, 0x65, 0xae, 0xd3, 0x1a, 0x41, 0x02, 0x8b, 
+    0x58, 0x82, 0x04, 0x11, 0x0a, 0xaa, 0x28, 0xa1, 0x0c, 0x1b, 0x51, 0xda, 
+    0x75, 0x52, 0x2c, 0xa4, 0xe8, 0x3c, 0xde, 0xc1, 0x3f, 0xe4, 0xfa, 0x25, 
+    0x72, 0x29, 0xe4, 0x2a, 0x81, 0x91, 0x63, 0x01, 0x15, 0x68, 0x90, 0x5d, 
+    0x3f, 0xf8, 0x1f, 0xfc, 0x9e, 0xad, 0x95, 0x9f, 0x9a, 0xf4, 0x92, 0x42, 
+    0x71, 0x20, 0xf0, 0xe2, 0x38, 0x1f, 0x63, 0x40, 0x70, 0x17, 0x68, 0xd4, 
+    0x1c, 0xe7, 0xfb, 0xd8, 0x71, 0x1a, 0x27, 0x80, 0xff, 0x19, 0xb8, 0xd2, 
+    0x5b, 0xfe, 0x4a, 0x1d, 0x98, 0xfd, 0x24, 0xbd, 0xd6, 0xd2, 0x22, 0x47, 
+    0x40, 0xff, 0x36, 0x70, 0x71, 0xdd, 0xd2, 0x94, 0x3d, 0xe0, 0x72, 0x07, 
+    0x18, 0x7c, 0x32, 0x64, 0x53, 0x76, 0x25, 0x3f, 0x2d, 0x21, 0x9f, 0x07, 
+    0xde, 0xcf, 0xe8, 0x9b, 0xb2, 0xc0, 0xc0, 0x2d, 0xd0, 0xbb, 0xe6, 0xcd, 
+    0xad, 0x79, 0x8e, 0xd3, 0x07, 0x20, 0x4d, 0xb3, 0x4a, 0xde, 0x00, 0x07, 
+    0x87, 0xc0, 0x78, 0x81, 0xb2, 0xd7, 0x3b, 0xbc, 0xbb, 0xa7, 0x7d, 0x6e, 
+    0xff, 0xf6, 0x34, 0xe7, 0xf7, 0x03, 0x44, 0xe2, 0x72, 0x94, 0xa3, 0x98, 
+    0x6e, 0x72, 0x00, 0x00, 0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 
+    0x2e, 0x23, 0x00, 0x00, 0x2e, 0x23, 0x01, 0x78, 0xa5, 0x3f, 0x76, 0x00, 
+    0x00, 0x00, 0x07, 0x74, 0x49, 0x4d, 0x45, 0x07, 0xe7, 0x05, 0x06, 0x01, 
+    0x2e, 0x34, 0x01, 0x6f, 0xc6, 0x98, 0x00, 0x00, 0x00, 0x19, 0x74, 0x45, 
+    0x58, 0x74, 0x43, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0x43, 0x72, 
+    0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x47, 
+    0x49, 0x4d, 0x50, 0x57, 0x81, 0x0e, 0x17, 0x00, 0x00, 0x00, 0xe8, 0x49, 
+    0x44, 0x41, 0x54, 0x38, 0xcb, 0xc5, 0xd3, 0x31, 0x4a, 0x03, 0x51, 0x18, 
+    0x04, 0xe0, 0x6f, 0x93, 0x14, 0x16, 0x49, 0x25, 0x12, 0xd0, 0x42, 0xb0, 
+    0x11, 0xdb, 0x78, 0x00, 0x03, 0xde, 0xc0, 0xde, 0xde, 0xca, 0x2b, 0xb8, 
+    0x67, 0x10, 0x2c, 0x8c, 0xb7, 0x58, 0x2f, 0xa0, 0x9d, 0x85, 0x59, 0xb6, 
+    0x8b, 0x6d, 0x10, 0x05, 0x89, 0x20, 0x58, 0xba, 0xc2, 0x5a, 0xe4, 0x15, 
+    0x61, 0xcd, 0x6e, 0x56, 0x52, 0x38, 0xe5, 0x9b, 0x61, 0xe6, 0x7f, 0xf3, 
+    0xbf, 0xc7, 0x6f, 0xdc, 0xe1, 0x11, 0x6f, 0x18, 0x23, 0xf6, 0x47, 0xc4, 
+    0x28, 0xce, 0xf9, 0x4e, 0xc8, 0xf1, 0x8a, 0x49, 0x38, 0x8f, 0x31, 0x58, 
+    0x14, 0xb7, 0x96, 0x18, 0x24, 0x48, 0x8f, 0x69, 0x67, 0x74, 0x32, 0x7a, 
+    0xa7, 0xec, 0xe2, 0x28, 0xf0, 0x37, 0x28, 0x70, 0x5d, 0x65, 0x00, 0x36, 
+    0xc9, 0xfb, 0x73, 0x61, 0x77, 0x8f, 0x8d, 0x8c, 0x61, 0xc6, 0x45, 0xa0, 
+    0xdf, 0x71, 0x52, 0x65, 0x90, 0x62, 0xd0, 0x25, 0xff, 0x20, 0x9a, 0x62, 
+    0x87, 0x68, 0x82, 0x87, 0x39, 0xff, 0x89, 0x2b, 0x6c, 0xd5, 0x4d, 0x90, 
+    0xce, 0xf8, 0x3a, 0xc0, 0x0b, 0xfa, 0x98, 0xe2, 0x8c, 0x27, 0xdc, 0x37, 
+    0x29, 0x36, 0xbe, 0x64, 0x36, 0xe2, 0x39, 0x24, 0xc6, 0x61, 0x23, 0xe3, 
+    0xb2, 0x30, 0xaa, 0xd9, 0xc4, 0x10, 0x3d, 0xdc, 0x2e, 0x96, 0x5b, 0x16, 
+    0x76, 0x56, 0x4c, 0x72, 0xb8, 0x6a, 0xd4, 0xaa, 0x0e, 0x92, 0x90, 0xbe, 
+    0x16, 0x8a, 0x26, 0xa2, 0xd6, 0xba, 0x29, 0x75, 0x06, 0x69, 0xf9, 0xd9, 
+    0x2e, 0x43, 0xbb, 0x86, 0xdb, 0xc6, 0x7e, 0xf8, 0x5c, 0xff, 0x73, 0x85, 
+    0x46, 0xf8, 0x01, 0xeb, 0x8c, 0x33, 0x9f, 0xa4, 0x40, 0x0e, 0xfd, 0x00, 
+    0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
+};
+
+/* numbers.png */
+const unsigned char data_numbers_png[1675] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 
+    0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x10, 
+    0x08, 0x06, 0x00, 0x00, 0x00, 0xf9, 0xf6, 0xf6, 0x60, 0x00, 0x00, 0x01, 
+    0x84, 0x69, 0x43, 0x43, 0x50, 0x49, 0x43, 0x43, 0x20, 0x70, 0x72, 0x6f, 
+    0x66, 0x69, 0x6c, 0x65, 0x00, 0x00, 0x28, 0x91, 0x7d, 0x91, 0x3d, 0x48, 
+    0xc3, 0x50, 0x14, 0x85, 0x4f, 0x53, 0x6b, 0x55, 0x2a, 0x0e, 0x76, 0x10, 
+    0x71, 0xc8, 0x50, 0x9d, 0xec, 0xa2, 0x22, 0x8e, 0x5a, 0x85, 0x22, 0x54, 
+    0x08, 0xb5, 0x42, 0xab, 0x0e, 0x26, 0x2f, 0xfd, 0x83, 0x26, 0x0d, 0x49, 
+    0x8a, 0x8b, 0xa3, 0xe0, 0x5a, 0x70, 0xf0, 0x67, 0xb1, 0xea, 0xe0, 0xe2, 
+    0xac, 0xab, 0x83, 0xab, 0x20, 0x08, 0xfe, 0x80, 0xb8, 0xba, 0x38, 0x29, 
+    0xba, 0x48, 0x89, 0xf7, 0x25, 0x85, 0x16, 0x31, 0x3e, 0xb8, 0xbc, 0x8f, 
+    0xf3, 0xde, 0x39, 0xdc, 0x77, 0x1f, 0x20, 0x34, 0x2a, 0x4c, 0xb3, 0xba, 
+    0x66, 0x01, 0x4d, 0xb7, 0xcd, 0x74, 0x32, 0x21, 0x66, 0x73, 0xab, 0x62, 
+    0xf8, 0x15, 0x21, 0x74, 0x53, 0xf5, 0x22, 0x28, 0x33, 0xcb, 0x98, 0x93, 
+    0xa4, 0x14, 0x7c, 0xd7, 0xd7, 0x3d, 0x02, 0x7c, 0xbf, 0x8b, 0xf3, 0x2c, 
+    0xff, 0x7b, 0x7f, 0xae, 0x7e, 0x35, 0x6f, 0x31, 0x20, 0x20, 0x12, 0xcf, 
+    0x32, 0xc3, 0xb4, 0x89, 0x37, 0x88, 0xa7, 0x37, 0x6d, 0x83, 0xf3, 0x3e, 
+    0x71, 0x94, 0x95, 0x64, 0x95, 0xf8, 0x9c, 0x78, 0xdc, 0xa4, 0x06, 0x89, 
+    0x1f, 0xb9, 0xae, 0x78, 0xfc, 0xc6, 0xb9, 0xe8, 0xb2, 0xc0, 0x33, 0xa3, 
+    0x66, 0x26, 0x3d, 0x4f, 0x1c, 0x25, 0x16, 0x8b, 0x1d, 0xac, 0x74, 0x30, 
+    0x2b, 0x99, 0x1a, 0xf1, 0x14, 0x71, 0x4c, 0xd5, 0x74, 0xca, 0x17, 0xb2, 
+    0x1e, 0xab, 0x9c, 0xb7, 0x38, 0x6b, 0x95, 0x1a, 0x6b, 0xf5, 0xc9, 0x5f, 
+    0x18, 0xc9, 0xeb, 0x2b, 0xcb, 0x5c, 0xa7, 0x1a, 0x41, 0x12, 0x8b, 0x58, 
+    0x82, 0x04, 0x11, 0x0a, 0x6a, 0x28, 0xa3, 0x02, 0x1b, 0x71, 0xda, 0x75, 
+    0x52, 0x2c, 0xa4, 0xe9, 0x3c, 0xe1, 0xe3, 0x1f, 0x76, 0xfd, 0x12, 0xb9, 
+    0x14, 0x72, 0x95, 0xc1, 0xc8, 0xb1, 0x80, 0x2a, 0x34, 0xc8, 0xae, 0x1f, 
+    0xfc, 0x0f, 0x7e, 0xcf, 0xd6, 0x2a, 0x4c, 0x4e, 0x78, 0x49, 0x91, 0x04, 
+    0x10, 0x7a, 0x71, 0x9c, 0x8f, 0x51, 0x20, 0xbc, 0x0b, 0x34, 0xeb, 0x8e, 
+    0xf3, 0x7d, 0xec, 0x38, 0xcd, 0x13, 0x20, 0xf8, 0x0c, 0x5c, 0xe9, 0x6d, 
+    0x7f, 0xb5, 0x01, 0xcc, 0x7c, 0x92, 0x5e, 0x6f, 0x6b, 0xb1, 0x23, 0x60, 
+    0x60, 0x1b, 0xb8, 0xb8, 0x6e, 0x6b, 0xca, 0x1e, 0x70, 0xb9, 0x03, 0x0c, 
+    0x3d, 0x19, 0xb2, 0x29, 0xbb, 0x52, 0x90, 0x4a, 0x28, 0x14, 0x80, 0xf7, 
+    0x33, 0xfa, 0xa6, 0x1c, 0x30, 0x78, 0x0b, 0xf4, 0xad, 0x79, 0x73, 0x6b, 
+    0x9d, 0xe3, 0xf4, 0x01, 0xc8, 0xd0, 0xac, 0x52, 0x37, 0xc0, 0xc1, 0x21, 
+    0x30, 0x56, 0xa4, 0xec, 0x75, 0x9f, 0x77, 0xf7, 0x74, 0xce, 0xed, 0xdf, 
+    0x3b, 0xad, 0xf9, 0xfd, 0x00, 0xe1, 0x33, 0x72, 0x6c, 0xc1, 0xea, 0xdd, 
+    0xe8, 0x00, 0x00, 0x00, 0x06, 0x62, 0x4b, 0x47, 0x44, 0x00, 0xd0, 0x00, 
+    0x00, 0x00, 0x00, 0x70, 0xb6, 0xc4, 0x26, 0x00, 0x00, 0x00, 0x09, 0x70, 
+    0x48, 0x59, 0x73, 0x00, 0x00, 0x2e, 0x23, 0x00, 0x00, 0x2e, 0x23, 0x01, 
+    0x78, 0xa5, 0x3f, 0x76, 0x00, 0x00, 0x00, 0x07, 0x74, 0x49, 0x4d, 0x45, 
+    0x07, 0xe7, 0x05, 0x06, 0x05, 0x12, 0x30, 0x72, 0xf8, 0xd3, 0xa2, 0x00, 
+    0x00, 0x00, 0x19, 0x74, 0x45, 0x58, 0x74, 0x43, 0x6f, 0x6d, 0x6d, 0x65, 
+    0x6e, 0x74, 0x00, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 
+    0x69, 0x74, 0x68, 0x20, 0x47, 0x49, 0x4d, 0x50, 0x57, 0x81, 0x0e, 0x17, 
+    0x00, 0x00, 0x04, 0x63, 0x49, 0x44, 0x41, 0x54, 0x68, 0xde, 0xed, 0x98, 
+    0xcf, 0x6b, 0x5c, 0x55, 0x14, 0xc7, 0x3f, 0xe7, 0xce, 0x0c, 0x4c, 0x4d, 
+    0x8a, 0x6e, 0x32, 0x86, 0x62, 0x24, 0x90, 0x4a, 0x35, 0x15, 0x69, 0x26, 
+    0x21, 0x52, 0xdc, 0x0c, 0xa1, 0x54, 0xfc, 0x07, 0x1c, 0x41, 0xe8, 0xc6, 
+    0x55, 0x36, 0x4a, 0x24, 0xd4, 0xc6, 0x45, 0x09, 0x54, 0xdb, 0x0c, 0x45, 
+    0x02, 0x59, 0x45, 0x48, 0x91, 0x52, 0xa4, 0xc6, 0x7f, 0x21, 0x81, 0x74, 
+    0xe7, 0x26, 0x69, 0x53, 0x24, 0xad, 0x56, 0x05, 0x13, 0x15, 0xeb, 0x24, 
+    0x62, 0x61, 0xd2, 0x37, 0x2e, 0x32, 0xef, 0xb8, 0xc8, 0xcc, 0x9b, 0x37, 
+    0x33, 0xef, 0xcd, 0xbc, 0xf7, 0x26, 0x26, 0x5d, 0xcc, 0x59, 0xcd, 0x8f, 
+    0xf7, 0x3d, 0xe7, 0xde, 0x73, 0xcf, 0xfd, 0x9e, 0xf3, 0x7d, 0xd0, 0xb1, 
+    0x8e, 0xb5, 0x61, 0x52, 0xf9, 0xf0, 0xf2, 0xb7, 0x27, 0x07, 0xd5, 0xe6, 
+    0x72, 0xc3, 0x03, 0x62, 0x16, 0xb6, 0xb2, 0x8f, 0x96, 0x83, 0x3a, 0x2c, 
+    0xdc, 0x3d, 0x3d, 0x28, 0xd8, 0x97, 0x3d, 0xfe, 0x5a, 0xe8, 0x4e, 0x3f, 
+    0x6c, 0xe9, 0xa7, 0x30, 0xc7, 0xa0, 0x94, 0xf0, 0xc6, 0x4f, 0xb0, 0x1c, 
+    0x66, 0x73, 0x5f, 0x42, 0xe2, 0x49, 0x0f, 0xb7, 0x00, 0x6c, 0xc3, 0xc2, 
+    0xd4, 0x5f, 0xfe, 0xf8, 0xab, 0xbd, 0x0c, 0xc6, 0xbc, 0xe3, 0xd6, 0x58, 
+    0x54, 0x3f, 0xcf, 0x7a, 0xfc, 0xa8, 0xf8, 0xb8, 0xf3, 0x40, 0x89, 0x94, 
+    0x18, 0xc9, 0xd6, 0x3f, 0xa0, 0xe8, 0x1d, 0x08, 0x71, 0x70, 0x52, 0x4a, 
+    0x09, 0x8d, 0x7e, 0x50, 0x09, 0xe6, 0xa7, 0x44, 0x4a, 0xc0, 0x03, 0x4f, 
+    0xb8, 0x75, 0x00, 0x7f, 0xf6, 0x13, 0x4b, 0x5a, 0x65, 0x5f, 0x2d, 0xf0, 
+    0x02, 0x29, 0x15, 0x8f, 0xb8, 0x21, 0xd7, 0xe1, 0xeb, 0xe7, 0x19, 0x8f, 
+    0x1f, 0x15, 0xef, 0x14, 0x90, 0x89, 0x69, 0x41, 0xd5, 0xac, 0x55, 0x4e, 
+    0x1b, 0x48, 0x87, 0x39, 0xac, 0x0a, 0xf3, 0x08, 0x0c, 0x03, 0x3b, 0x08, 
+    0x9b, 0xae, 0xe0, 0x09, 0x44, 0xe7, 0x76, 0xef, 0xbe, 0x96, 0xf1, 0x63, 
+    0xa2, 0x0a, 0xf3, 0x38, 0x78, 0x5c, 0x78, 0x48, 0x20, 0xcc, 0xed, 0xce, 
+    0x92, 0x09, 0xca, 0x44, 0xb9, 0x5e, 0x46, 0xf5, 0x29, 0x63, 0x55, 0x8e, 
+    0x0d, 0x65, 0x0f, 0x10, 0x8a, 0x5e, 0x7f, 0x18, 0x25, 0xef, 0xf5, 0xfb, 
+    0x67, 0x27, 0xe8, 0x8b, 0xef, 0x91, 0xa5, 0xc4, 0x30, 0xc2, 0x16, 0xc2, 
+    0xb6, 0x6b, 0xff, 0x31, 0x03, 0x17, 0x66, 0x52, 0x74, 0x03, 0x4b, 0x97, 
+    0xf2, 0xdc, 0x6f, 0x70, 0xb0, 0x47, 0x81, 0x18, 0x6b, 0x3e, 0x45, 0xd3, 
+    0xf2, 0x3c, 0x2a, 0xcc, 0xa1, 0x76, 0x63, 0xfe, 0x55, 0x49, 0x08, 0xcc, 
+    0xe5, 0x7a, 0xc8, 0xf8, 0x31, 0x49, 0x54, 0xbc, 0x53, 0x40, 0x5b, 0xef, 
+    0xfe, 0xb2, 0x06, 0x8c, 0x00, 0xf4, 0x7f, 0xd5, 0x9f, 0x2c, 0x3d, 0x97, 
+    0x28, 0x86, 0x6b, 0x86, 0x55, 0xe6, 0x51, 0xcc, 0x50, 0xf7, 0x99, 0x8d, 
+    0x75, 0x67, 0x01, 0x2b, 0xfd, 0x49, 0xeb, 0x85, 0x63, 0x45, 0x11, 0xb2, 
+    0xbe, 0x4c, 0xe4, 0x62, 0x1e, 0x85, 0xa1, 0xee, 0x09, 0xaa, 0xf8, 0x69, 
+    0x92, 0xd6, 0xf3, 0x14, 0x05, 0xb2, 0x41, 0x6f, 0x92, 0x96, 0x18, 0x43, 
+    0xb8, 0x16, 0xa5, 0x7a, 0x8c, 0xf2, 0xfe, 0xc5, 0x7c, 0x35, 0x7e, 0x10, 
+    0x8b, 0xd9, 0x0c, 0x00, 0xd7, 0x11, 0x30, 0xca, 0x90, 0x1b, 0x3f, 0xdd, 
+    0x4f, 0x32, 0x69, 0x51, 0x04, 0xce, 0x2a, 0x8c, 0x43, 0x63, 0x01, 0x4d, 
+    0xed, 0xe0, 0xe4, 0xbf, 0xde, 0x5c, 0xf8, 0x40, 0xcc, 0xe1, 0x17, 0x5f, 
+    0xc5, 0x3f, 0x7f, 0x51, 0xf1, 0xf1, 0x83, 0x1a, 0xa6, 0x8c, 0x5d, 0xbd, 
+    0x41, 0x71, 0x4a, 0x56, 0x68, 0xbc, 0xa1, 0x80, 0x5d, 0xc6, 0xdb, 0x58, 
+    0x51, 0xd7, 0xe1, 0xdc, 0xa4, 0x20, 0xed, 0xa0, 0x63, 0x6d, 0xdb, 0x81, 
+    0x15, 0x50, 0xd7, 0xf0, 0x0f, 0xbe, 0x37, 0x28, 0x10, 0xfe, 0x23, 0xda, 
+    0xc2, 0x7b, 0xdd, 0x24, 0x11, 0xce, 0xaa, 0xf2, 0xdd, 0x51, 0x27, 0x79, 
+    0xfa, 0x57, 0xfe, 0x75, 0x0b, 0x96, 0x4e, 0x01, 0x05, 0x34, 0x5d, 0x1d, 
+    0x4e, 0x3c, 0x35, 0xd6, 0x2d, 0x4b, 0x48, 0x86, 0x9a, 0xa7, 0xea, 0x94, 
+    0x98, 0x45, 0x6b, 0xfc, 0xd5, 0x17, 0x79, 0xd3, 0x28, 0x5f, 0xb3, 0xdf, 
+    0x4a, 0x2c, 0x84, 0x87, 0x46, 0xb1, 0x4a, 0x11, 0xd6, 0x6d, 0x0b, 0x33, 
+    0xb9, 0x1e, 0x9e, 0x44, 0x51, 0x31, 0x07, 0x81, 0xaf, 0x57, 0x91, 0x6a, 
+    0x85, 0xcb, 0x9f, 0x2d, 0x7c, 0x93, 0xeb, 0x71, 0x8d, 0x00, 0x6d, 0xe2, 
+    0x29, 0x62, 0xf4, 0xb0, 0x0b, 0xc8, 0x5a, 0x3f, 0x3d, 0x6a, 0x61, 0x9d, 
+    0x17, 0xad, 0xa8, 0x20, 0x19, 0xef, 0x4a, 0x3f, 0x98, 0x0f, 0x04, 0xf6, 
+    0x51, 0x62, 0x0a, 0x8b, 0x08, 0x3f, 0x7b, 0x32, 0x8f, 0x70, 0x0c, 0x65, 
+    0xa0, 0xdc, 0xc3, 0xdf, 0xba, 0x98, 0x67, 0xbd, 0xdc, 0xbb, 0xa3, 0xd8, 
+    0xdb, 0x5a, 0xc7, 0x17, 0xa2, 0x64, 0x73, 0x3d, 0x2c, 0x06, 0x2c, 0x84, 
+    0x76, 0xf1, 0xe4, 0x7a, 0x19, 0xfd, 0x47, 0x39, 0x8f, 0x3a, 0x73, 0xe1, 
+    0xf8, 0x54, 0x9e, 0x79, 0x7f, 0x71, 0x46, 0xde, 0x28, 0x8b, 0x2a, 0x64, 
+    0x80, 0x53, 0x2a, 0x9c, 0x6a, 0xc8, 0x91, 0xb2, 0xa8, 0xc6, 0x3b, 0x7f, 
+    0x53, 0x8f, 0xb9, 0x03, 0xc8, 0xb5, 0x5e, 0x32, 0x62, 0xb3, 0x52, 0x83, 
+    0xd7, 0x23, 0x60, 0x20, 0xdb, 0x2e, 0x8d, 0x89, 0xc8, 0x15, 0x84, 0x1b, 
+    0xd8, 0xf6, 0xbc, 0x4d, 0x69, 0x33, 0x28, 0xf6, 0xf8, 0xc4, 0xfe, 0x66, 
+    0xa2, 0x0e, 0xd1, 0x0e, 0x03, 0xb8, 0x6e, 0x8e, 0x08, 0x1f, 0x34, 0x53, 
+    0x21, 0x95, 0x04, 0x36, 0x1b, 0x62, 0x9b, 0x0d, 0xa1, 0x75, 0x43, 0xf8, 
+    0xd0, 0xc5, 0xed, 0x70, 0x43, 0xac, 0x8f, 0x08, 0xb8, 0x82, 0x72, 0x43, 
+    0x94, 0x79, 0x3b, 0xce, 0x66, 0xa8, 0x21, 0x3a, 0x6a, 0x7c, 0x2f, 0x35, 
+    0xd8, 0x44, 0x05, 0x1e, 0x78, 0x01, 0x39, 0x72, 0xbe, 0x32, 0xc4, 0xda, 
+    0xb2, 0xda, 0x95, 0xfe, 0x71, 0xb5, 0x25, 0x63, 0x7d, 0x41, 0x9f, 0x6d, 
+    0xca, 0xb7, 0x2d, 0xc6, 0xcd, 0xe3, 0x1f, 0xba, 0x64, 0x70, 0x54, 0x06, 
+    0xd1, 0x9a, 0x24, 0x8c, 0xa8, 0x30, 0xe2, 0x97, 0x40, 0x47, 0x86, 0xef, 
+    0xb7, 0x9b, 0x9b, 0x9f, 0x3e, 0x6e, 0x2b, 0x7e, 0x64, 0x73, 0xad, 0x63, 
+    0xb2, 0xfc, 0x42, 0x65, 0xf5, 0xd2, 0x36, 0xab, 0x87, 0x18, 0x17, 0x5b, 
+    0x78, 0xc7, 0xbd, 0xff, 0x66, 0x2a, 0xf0, 0xe0, 0x19, 0xa8, 0x5e, 0xce, 
+    0xa7, 0x37, 0x02, 0xc9, 0xe1, 0x92, 0x61, 0xc0, 0xc0, 0xf5, 0x72, 0x0b, 
+    0x5b, 0x86, 0x70, 0x07, 0x68, 0xf6, 0xd8, 0x55, 0x53, 0x2b, 0x8f, 0x15, 
+    0x44, 0xe0, 0x8d, 0xf2, 0xd7, 0xdf, 0x81, 0xbf, 0x8d, 0xb2, 0xd3, 0x54, 
+    0x86, 0x03, 0xf1, 0x08, 0xf1, 0x0f, 0xca, 0xdc, 0xeb, 0xa8, 0x67, 0x92, 
+    0xc3, 0x8a, 0x1b, 0x66, 0xff, 0x4e, 0x01, 0x9d, 0xb8, 0x3d, 0xd0, 0x17, 
+    0x33, 0xa6, 0x5c, 0x81, 0x1a, 0xaf, 0xdc, 0x5e, 0x81, 0x73, 0x7d, 0x8b, 
+    0xaf, 0x74, 0x3b, 0xed, 0x41, 0x65, 0xe9, 0x8f, 0xf7, 0x1e, 0x35, 0xbc, 
+    0xc7, 0xb0, 0xbe, 0x7f, 0xbd, 0xcf, 0xde, 0xb3, 0xb3, 0x22, 0x3a, 0x50, 
+    0xbd, 0xf9, 0xf6, 0x85, 0xdd, 0x7b, 0x83, 0xe7, 0x6a, 0xe9, 0x50, 0x96, 
+    0xba, 0xd3, 0x1b, 0xf7, 0x9b, 0x16, 0x03, 0x4c, 0xee, 0xce, 0x56, 0x13, 
+    0x67, 0x09, 0xc9, 0x66, 0x7d, 0x18, 0xe0, 0x93, 0x1d, 0x56, 0x81, 0x33, 
+    0x7e, 0xef, 0x4f, 0x14, 0x3e, 0x6f, 0x36, 0x43, 0xd4, 0x14, 0xb3, 0x30, 
+    0x39, 0x93, 0xaa, 0x19, 0x22, 0x43, 0x0d, 0xa1, 0x51, 0xf0, 0x0e, 0x03, 
+    0x28, 0x99, 0x76, 0x8b, 0xe1, 0x30, 0xd7, 0xef, 0xf4, 0xfc, 0x97, 0x6e, 
+    0x9f, 0xcc, 0x88, 0x91, 0x95, 0x00, 0xfe, 0xc7, 0x7f, 0xcb, 0xfe, 0xd4, 
+    0x70, 0x10, 0x85, 0x7b, 0xaf, 0x66, 0x0c, 0x01, 0xf0, 0x2d, 0x86, 0xe9, 
+    0xc2, 0x2c, 0x19, 0x03, 0x2b, 0x1e, 0x53, 0xe2, 0x78, 0xd7, 0xc7, 0xc1, 
+    0x0a, 0xc0, 0xa7, 0x80, 0xc6, 0x83, 0x14, 0x50, 0x65, 0x88, 0xf4, 0x18, 
+    0x52, 0xff, 0x57, 0xbc, 0x1b, 0xd7, 0x0e, 0xf3, 0x1c, 0xf6, 0xfa, 0x4d, 
+    0xe7, 0x55, 0x58, 0xc7, 0x3a, 0xd6, 0xb1, 0x23, 0xb3, 0xff, 0x00, 0x19, 
+    0x06, 0x6b, 0x40, 0x08, 0x49, 0x42, 0x94, 0x00, 0x00, 0x00, 0x00, 0x49, 
+    0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
+};
+
+/* game_over.png */
+const unsigned char data_game_over_png[1342] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 
+    0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x00, 0x00, 0xf0, 
+    0x08, 0x06, 0x00, 0x00, 0x00, 0xd8, 0x75, 0xb7, 0xba, 0x00, 0x00, 0x01, 
+    0x84, 0x69, 0x43, 0x43, 0x50, 0x49, 0x43, 0x43, 0x20, 0x70, 0x72, 0x6f, 
+    0x66, 0x69, 0x6c, 0x65, 0x00, 0x00, 0x28, 0x91, 0x7d, 0x91, 0x3d, 0x48, 
+    0xc3, 0x40, 0x1c, 0xc5, 0x5f, 0xd3, 0xd6, 0x8a, 0x54, 0x1c, 0xec, 0x20, 
+    0xe2, 0x10, 0xa1, 0x3a, 0xd9, 0xc5, 0x2f, 0x1c, 0x6b, 0x15, 0x8a, 0x50, 
+    0x21, 0xd4, 0x0a, 0xad, 0x3a, 0x98, 0x5c, 0xfa, 0x21, 0x34, 0x69, 0x48, 
+    0x5a, 0x5c, 0x1c, 0x05, 0xd7, 0x82, 0x83, 0x1f, 0x8b, 0x55, 0x07, 0x17, 
+    0x67, 0x5d, 0x1d, 0x5c, 0x05, 0x41, 0xf0, 0x03, 0xc4, 0xd5, 0xc5, 0x49, 
+    0xd1, 0x45, 0x4a, 0xfc, 0x5f, 0x52, 0x68, 0x11, 0xe3, 0xc1, 0x71, 0x3f, 
+    0xde, 0xdd, 0x7b, 0xdc, 0xbd, 0x03, 0x84, 0x46, 0x99, 0x69, 0x56, 0x20, 
+    0x0e, 0x68, 0x7a, 0xd5, 0x4c, 0x27, 0x13, 0x62, 0x36, 0xb7, 0x22, 0x86, 
+    0x5e, 0x11, 0x44, 0x17, 0x02, 0x18, 0xc6, 0x94, 0xcc, 0x2c, 0x63, 0x56, 
+    0x92, 0x52, 0xf0, 0x1c, 0x5f, 0xf7, 0xf0, 0xf1, 0xf5, 0x2e, 0xc6, 0xb3, 
+    0xbc, 0xcf, 0xfd, 0x39, 0x7a, 0xd5, 0xbc, 0xc5, 0x00, 0x9f, 0x48, 0x1c, 
+    0x67, 0x86, 0x59, 0x25, 0x5e, 0x27, 0x9e, 0xde, 0xac, 0x1a, 0x9c, 0xf7, 
+    0x89, 0x23, 0xac, 0x24, 0xab, 0xc4, 0xe7, 0xc4, 0x63, 0x26, 0x5d, 0x90, 
+    0xf8, 0x91, 0xeb, 0x8a, 0xcb, 0x6f, 0x9c, 0x8b, 0x0e, 0x0b, 0x3c, 0x33, 
+    0x62, 0x66, 0xd2, 0x73, 0xc4, 0x11, 0x62, 0xb1, 0xd8, 0xc1, 0x4a, 0x07, 
+    0xb3, 0x92, 0xa9, 0x11, 0x4f, 0x12, 0x47, 0x55, 0x4d, 0xa7, 0x7c, 0x21, 
+    0xeb, 0xb2, 0xca, 0x79, 0x8b, 0xb3, 0x56, 0xae, 0xb1, 0xd6, 0x3d, 0xf9, 
+    0x0b, 0xc3, 0x79, 0x7d, 0x79, 0x89, 0xeb, 0x34, 0x87, 0x90, 0xc4, 0x02, 
+    0x16, 0x21, 0x41, 0x84, 0x82, 0x1a, 0x36, 0x50, 0x46, 0x15, 0x31, 0x5a, 
+    0x75, 0x52, 0x2c, 0xa4, 0x69, 0x3f, 0xe1, 0xe1, 0x1f, 0x74, 0xfc, 0x12, 
+    0xb9, 0x14, 0x72, 0x6d, 0x80, 0x91, 0x63, 0x1e, 0x15, 0x68, 0x90, 0x1d, 
+    0x3f, 0xf8, 0x1f, 0xfc, 0xee, 0xd6, 0x2a, 0x4c, 0x8c, 0xbb, 0x49, 0xe1, 
+    0x04, 0x10, 0x7c, 0xb1, 0xed, 0x8f, 0x11, 0x20, 0xb4, 0x0b, 0x34, 0xeb, 
+    0xb6, 0xfd, 0x7d, 0x6c, 0xdb, 0xcd, 0x13, 0xc0, 0xff, 0x0c, 0x5c, 0xe9, 
+    0x6d, 0x7f, 0xa5, 0x01, 0xcc, 0x7c, 0x92, 0x5e, 0x6f, 0x6b, 0xd1, 0x23, 
+    0xa0, 0x6f, 0x1b, 0xb8, 0xb8, 0x6e, 0x6b, 0xca, 0x1e, 0x70, 0xb9, 0x03, 
+    0x0c, 0x3c, 0x19, 0xb2, 0x29, 0x3b, 0x92, 0x9f, 0xa6, 0x50, 0x28, 0x00, 
+    0xef, 0x67, 0xf4, 0x4d, 0x39, 0xa0, 0xff, 0x16, 0xe8, 0x59, 0x75, 0x7b, 
+    0x6b, 0xed, 0xe3, 0xf4, 0x01, 0xc8, 0x50, 0x57, 0xa9, 0x1b, 0xe0, 0xe0, 
+    0x10, 0x18, 0x2d, 0x52, 0xf6, 0x9a, 0xc7, 0xbb, 0xbb, 0x3b, 0x7b, 0xfb, 
+    0xf7, 0x4c, 0xab, 0xbf, 0x1f, 0x97, 0x13, 0x72, 0xb5, 0xb1, 0x61, 0x9b, 
+    0xa7, 0x00, 0x00, 0x00, 0x06, 0x62, 0x4b, 0x47, 0x44, 0x00, 0xd0, 0x00, 
+    0x00, 0x00, 0x00, 0x70, 0xb6, 0xc4, 0x26, 0x00, 0x00, 0x00, 0x09, 0x70, 
+    0x48, 0x59, 0x73, 0x00, 0x00, 0x2e, 0x23, 0x00, 0x00, 0x2e, 0x23, 0x01, 
+    0x78, 0xa5, 0x3f, 0x76, 0x00, 0x00, 0x00, 0x07, 0x74, 0x49, 0x4d, 0x45, 
+    0x07, 0xe7, 0x05, 0x06, 0x04, 0x23, 0x10, 0x8e, 0x09, 0x9e, 0xef, 0x00, 
+    0x00, 0x00, 0x19, 0x74, 0x45, 0x58, 0x74, 0x43, 0x6f, 0x6d, 0x6d, 0x65, 
+    0x6e, 0x74, 0x00, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 
+    0x69, 0x74, 0x68, 0x20, 0x47, 0x49, 0x4d, 0x50, 0x57, 0x81, 0x0e, 0x17, 
+    0x00, 0x00, 0x03, 0x16, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0xed, 0xdd, 
+    0x31, 0x4e, 0xc3, 0x30, 0x00, 0x05, 0xd0, 0x0f, 0xca, 0x21, 0x18, 0xca, 
+    0x39, 0xda, 0x93, 0x75, 0x08, 0x03, 0x9d, 0x32, 0x70, 0x31, 0xe0, 0x1c, 
+    0x65, 0xe1, 0x0e, 0x48, 0x65, 0x60, 0x85, 0x4a, 0x4d, 0x1d, 0x63, 0xa7, 
+    0xef, 0xad, 0x55, 0x5b, 0xc7, 0x71, 0xfa, 0x65, 0xa9, 0x5f, 0x4e, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x85, 0xdc, 0xb5, 0x3e, 
+    0xc0, 0x31, 0x39, 0xd5, 0xfc, 0xbe, 0xa9, 0x83, 0x39, 0x01, 0xcf, 0xa9, 
+    0xe7, 0x94, 0xfe, 0xdd, 0x9b, 0x02, 0x00, 0x10, 0xc0, 0x00, 0x20, 0x80, 
+    0x01, 0x00, 0x01, 0x0c, 0x00, 0x02, 0x18, 0x00, 0x10, 0xc0, 0x00, 0xd0, 
+    0x95, 0x26, 0xfe, 0xca, 0x3f, 0xb3, 0xc2, 0xf0, 0x3e, 0x25, 0x3b, 0xb7, 
+    0x10, 0xd6, 0xf7, 0x9c, 0x8e, 0xc9, 0x5b, 0x92, 0xed, 0xa5, 0xef, 0x53, 
+    0x4f, 0xc2, 0x0e, 0x18, 0x00, 0x10, 0xc0, 0x00, 0x20, 0x80, 0x01, 0x00, 
+    0x01, 0x0c, 0x00, 0x02, 0x18, 0x00, 0x04, 0x30, 0x00, 0xb0, 0x94, 0xc1, 
+    0x14, 0x2c, 0x67, 0x9f, 0x6c, 0x86, 0xe4, 0xd8, 0xc2, 0x58, 0xce, 0xd5, 
+    0x33, 0x6a, 0x9f, 0x64, 0x53, 0xda, 0x57, 0xf2, 0xf8, 0x92, 0x7c, 0x94, 
+    0xfc, 0x4c, 0xa7, 0xfb, 0xac, 0x4f, 0xcd, 0x1a, 0xd5, 0x53, 0xb2, 0x3b, 
+    0x25, 0xaf, 0xb5, 0xd6, 0x41, 0x0f, 0xeb, 0x75, 0x89, 0xf9, 0xef, 0xbd, 
+    0xc2, 0x6a, 0x07, 0x0c, 0x00, 0x02, 0x18, 0x00, 0x04, 0x30, 0x00, 0x20, 
+    0x80, 0x01, 0x40, 0x00, 0x03, 0x00, 0x02, 0x18, 0x00, 0xfa, 0xb2, 0xca, 
+    0x1a, 0xd2, 0x98, 0x1c, 0x92, 0x3c, 0x97, 0xfc, 0xcc, 0x05, 0x6a, 0x3c, 
+    0x55, 0x4f, 0x89, 0x59, 0x40, 0xd5, 0x7a, 0xc0, 0xb9, 0xeb, 0x1e, 0x92, 
+    0xe3, 0xd8, 0xf9, 0x7d, 0xfb, 0x6b, 0x2c, 0xea, 0x49, 0xdc, 0xf8, 0x7a, 
+    0xdd, 0xce, 0xbc, 0xee, 0xcf, 0x29, 0x79, 0xb0, 0x03, 0x06, 0x00, 0x04, 
+    0x30, 0x00, 0x08, 0x60, 0x00, 0x10, 0xc0, 0x00, 0x80, 0x00, 0x06, 0x00, 
+    0x01, 0x0c, 0x00, 0x94, 0xb4, 0xca, 0x1a, 0xd2, 0xf4, 0x53, 0x43, 0x3a, 
+    0xfc, 0xf6, 0x5a, 0x43, 0x35, 0x1e, 0xfa, 0xb4, 0xed, 0xfd, 0xf4, 0x28, 
+    0xac, 0xd7, 0x15, 0xfd, 0xd6, 0x77, 0x5d, 0xd3, 0xb3, 0x03, 0x06, 0x00, 
+    0x01, 0x0c, 0x00, 0x02, 0x18, 0x00, 0x10, 0xc0, 0x00, 0x20, 0x80, 0x01, 
+    0x00, 0x01, 0x0c, 0x00, 0x7d, 0x19, 0x4c, 0x01, 0x5c, 0x64, 0xd6, 0xe9, 
+    0x32, 0xfc, 0xbf, 0x99, 0x27, 0x63, 0xcd, 0xaa, 0xf1, 0x9c, 0xae, 0x18, 
+    0x8b, 0xf5, 0x7a, 0x3b, 0xcf, 0x9b, 0x1d, 0x30, 0x00, 0x08, 0x60, 0x00, 
+    0x10, 0xc0, 0x00, 0x80, 0x00, 0x06, 0x00, 0x01, 0x0c, 0x00, 0x08, 0x60, 
+    0x00, 0xe8, 0x4b, 0x13, 0x35, 0xa4, 0x9a, 0xf5, 0x80, 0x9a, 0xe3, 0xdf, 
+    0x27, 0x9b, 0x21, 0x39, 0xb6, 0x3e, 0xfe, 0x5b, 0xd5, 0xc3, 0xba, 0x6b, 
+    0xe9, 0xb4, 0x97, 0x96, 0xe6, 0xab, 0xf4, 0xbc, 0xcc, 0xbc, 0xb6, 0x73, 
+    0x8a, 0xd7, 0x67, 0xac, 0x57, 0x3b, 0x60, 0x00, 0x40, 0x00, 0x03, 0x80, 
+    0x00, 0x06, 0x00, 0x04, 0x30, 0x00, 0x08, 0x60, 0x00, 0x40, 0x00, 0x03, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 
+    0xca, 0x37, 0x46, 0xed, 0x69, 0x32, 0x7c, 0x66, 0xb1, 0x6b, 0x00, 0x00, 
+    0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
+};
+
+/* victory.png */
+const unsigned char data_victory_png[1321] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 
+    0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x00, 0x00, 0xf0, 
+    0x08, 0x06, 0x00, 0x00, 0x00, 0xd8, 0x75, 0xb7, 0xba, 0x00, 0x00, 0x01, 
+    0x84, 0x69, 0x43, 0x43, 0x50, 0x49, 0x43, 0x43, 0x20, 0x70, 0x72, 0x6f, 
+    0x66, 0x69, 0x6c, 0x65, 0x00, 0x00, 0x28, 0x91, 0x7d, 0x91, 0x3d, 0x48, 
+    0xc3, 0x40, 0x1c, 0xc5, 0x5f, 0xd3, 0xd6, 0x8a, 0x54, 0x1c, 0xec, 0x20, 
+    0xe2, 0x10, 0xa1, 0x3a, 0xd9, 0xc5, 0x2f, 0x1c, 0x6b, 0x15, 0x8a, 0x50, 
+    0x21, 0xd4, 0x0a, 0xad, 0x3a, 0x98, 0x5c, 0xfa, 0x21, 0x34, 0x69, 0x48, 
+    0x5a, 0x5c, 0x1c, 0x05, 0xd7, 0x82, 0x83, 0x1f, 0x8b, 0x55, 0x07, 0x17, 
+    0x67, 0x5d, 0x1d, 0x5c, 0x05, 0x41, 0xf0, 0x03, 0xc4, 0xd5, 0xc5, 0x49, 
+    0xd1, 0x45, 0x4a, 0xfc, 0x5f, 0x52, 0x68, 0x11, 0xe3, 0xc1, 0x71, 0x3f, 
+    0xde, 0xdd, 0x7b, 0xdc, 0xbd, 0x03, 0x84, 0x46, 0x99, 0x69, 0x56, 0x20, 
+    0x0e, 0x68, 0x7a, 0xd5, 0x4c, 0x27, 0x13, 0x62, 0x36, 0xb7, 0x22, 0x86, 
+    0x5e, 0x11, 0x44, 0x17, 0x02, 0x18, 0xc6, 0x94, 0xcc, 0x2c, 0x63, 0x56, 
+    0x92, 0x52, 0xf0, 0x1c, 0x5f, 0xf7, 0xf0, 0xf1, 0xf5, 0x2e, 0xc6, 0xb3, 
+    0xbc, 0xcf, 0xfd, 0x39, 0x7a, 0xd5, 0xbc, 0xc5, 0x00, 0x9f, 0x48, 0x1c, 
+    0x67, 0x86, 0x59, 0x25, 0x5e, 0x27, 0x9e, 0xde, 0xac, 0x1a, 0x9c, 0xf7, 
+    0x89, 0x23, 0xac, 0x24, 0xab, 0xc4, 0xe7, 0xc4, 0x63, 0x26, 0x5d, 0x90, 
+    0xf8, 0x91, 0xeb, 0x8a, 0xcb, 0x6f, 0x9c, 0x8b, 0x0e, 0x0b, 0x3c, 0x33, 
+    0x62, 0x66, 0xd2, 0x73, 0xc4, 0x11, 0x62, 0xb1, 0xd8, 0xc1, 0x4a, 0x07, 
+    0xb3, 0x92, 0xa9, 0x11, 0x4f, 0x12, 0x47, 0x55, 0x4d, 0xa7, 0x7c, 0x21, 
+    0xeb, 0xb2, 0xca, 0x79, 0x8b, 0xb3, 0x56, 0xae, 0xb1, 0xd6, 0x3d, 0xf9, 
+    0x0b, 0xc3, 0x79, 0x7d, 0x79, 0x89, 0xeb, 0x34, 0x87, 0x90, 0xc4, 0x02, 
+    0x16, 0x21, 0x41, 0x84, 0x82, 0x1a, 0x36, 0x50, 0x46, 0x15, 0x31, 0x5a, 
+    0x75, 0x52, 0x2c, 0xa4, 0x69, 0x3f, 0xe1, 0xe1, 0x1f, 0x74, 0xfc, 0x12, 
+    0xb9, 0x14, 0x72, 0x6d, 0x80, 0x91, 0x63, 0x1e, 0x15, 0x68, 0x90, 0x1d, 
+    0x3f, 0xf8, 0x1f, 0xfc, 0xee, 0xd6, 0x2a, 0x4c, 0x8c, 0xbb, 0x49, 0xe1, 
+    0x04, 0x10, 0x7c, 0xb1, 0xed, 0x8f, 0x11, 0x20, 0xb4, 0x0b, 0x34, 0xeb, 
+    0xb6, 0xfd, 0x7d, 0x6c, 0xdb, 0xcd, 0x13, 0xc0, 0xff, 0x0c, 0x5c, 0xe9, 
+    0x6d, 0x7f, 0xa5, 0x01, 0xcc, 0x7c, 0x92, 0x5e, 0x6f, 0x6b, 0xd1, 0x23, 
+    0xa0, 0x6f, 0x1b, 0xb8, 0xb8, 0x6e, 0x6b, 0xca, 0x1e, 0x70, 0xb9, 0x03, 
+    0x0c, 0x3c, 0x19, 0xb2, 0x29, 0x3b, 0x92, 0x9f, 0xa6, 0x50, 0x28, 0x00, 
+    0xef, 0x67, 0xf4, 0x4d, 0x39, 0xa0, 0xff, 0x16, 0xe8, 0x59, 0x75, 0x7b, 
+    0x6b, 0xed, 0xe3, 0xf4, 0x01, 0xc8, 0x50, 0x57, 0xa9, 0x1b, 0xe0, 0xe0, 
+    0x10, 0x18, 0x2d, 0x52, 0xf6, 0x9a, 0xc7, 0xbb, 0xbb, 0x3b, 0x7b, 0xfb, 
+    0xf7, 0x4c, 0xab, 0xbf, 0x1f, 0x97, 0x13, 0x72, 0xb5, 0xb1, 0x61, 0x9b, 
+    0xa7, 0x00, 0x00, 0x00, 0x06, 0x62, 0x4b, 0x47, 0x44, 0x00, 0xd0, 0x00, 
+    0x00, 0x00, 0x00, 0x70, 0xb6, 0xc4, 0x26, 0x00, 0x00, 0x00, 0x09, 0x70, 
+    0x48, 0x59, 0x73, 0x00, 0x00, 0x2e, 0x23, 0x00, 0x00, 0x2e, 0x23, 0x01, 
+    0x78, 0xa5, 0x3f, 0x76, 0x00, 0x00, 0x00, 0x07, 0x74, 0x49, 0x4d, 0x45, 
+    0x07, 0xe7, 0x05, 0x06, 0x04, 0x25, 0x34, 0xe4, 0x50, 0xdd, 0xb8, 0x00, 
+    0x00, 0x00, 0x19, 0x74, 0x45, 0x58, 0x74, 0x43, 0x6f, 0x6d, 0x6d, 0x65, 
+    0x6e, 0x74, 0x00, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 
+    0x69, 0x74, 0x68, 0x20, 0x47, 0x49, 0x4d, 0x50, 0x57, 0x81, 0x0e, 0x17, 
+    0x00, 0x00, 0x03, 0x01, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0xed, 0xdd, 
+    0xb1, 0x71, 0xc2, 0x30, 0x14, 0x80, 0x61, 0x39, 0xc7, 0x10, 0x94, 0x61, 
+    0x0a, 0x33, 0x40, 0xf6, 0xf1, 0x2c, 0x64, 0x1e, 0xf7, 0x21, 0x53, 0xb8, 
+    0x66, 0x0a, 0xa7, 0xa1, 0xa0, 0x41, 0x39, 0xbf, 0x08, 0x21, 0x91, 0xef, 
+    0xeb, 0x01, 0x21, 0x73, 0xfc, 0xa7, 0xe2, 0x9d, 0x52, 0x02, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0x06, 0x5b, 0xd0, 0x8e, 0x8f, 0xd3, 
+    0x61, 0x0d, 0xbc, 0xec, 0x7b, 0x9e, 0x96, 0xe3, 0xe6, 0xcf, 0xfa, 0x7c, 
+    0x3f, 0xa6, 0x75, 0xf8, 0xda, 0xfa, 0xba, 0x79, 0x5a, 0x86, 0x16, 0xd6, 
+    0xef, 0x79, 0x03, 0xbd, 0x7b, 0xb3, 0x05, 0x00, 0x20, 0xc0, 0x00, 0x20, 
+    0xc0, 0x00, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x02, 0x0c, 0x00, 
+    0x5d, 0xd9, 0xd9, 0x02, 0x4a, 0xc9, 0x8d, 0x28, 0x01, 0xe0, 0x04, 0x0c, 
+    0x00, 0x02, 0x0c, 0x00, 0x02, 0x0c, 0x00, 0x08, 0x30, 0x00, 0x08, 0x30, 
+    0x00, 0x20, 0xc0, 0x00, 0xd0, 0x33, 0x63, 0x48, 0x14, 0x53, 0xfb, 0x76, 
+    0x9f, 0xe0, 0xe7, 0x85, 0x45, 0xc6, 0xac, 0x1e, 0xb0, 0xc6, 0x31, 0xf7, 
+    0x9e, 0x8d, 0xac, 0xb1, 0x95, 0x7d, 0xcc, 0xfe, 0xb6, 0x4a, 0xbf, 0x67, 
+    0xef, 0xb7, 0x99, 0xe1, 0x04, 0x0c, 0x00, 0x02, 0x0c, 0x00, 0x08, 0x30, 
+    0x00, 0x08, 0x30, 0x00, 0x20, 0xc0, 0x00, 0x20, 0xc0, 0x00, 0x40, 0x9e, 
+    0x31, 0xa4, 0x86, 0xe4, 0x46, 0x04, 0x32, 0x23, 0x0e, 0x63, 0x68, 0xfc, 
+    0x61, 0x8d, 0xaf, 0xa5, 0xa6, 0xaa, 0xa3, 0x1d, 0xa7, 0xc3, 0x39, 0xa5, 
+    0x34, 0x6e, 0x5d, 0x4b, 0x6e, 0xaf, 0x82, 0xcf, 0xf4, 0x11, 0xdf, 0xad, 
+    0xeb, 0x7d, 0x0c, 0x1a, 0x83, 0xdf, 0xfb, 0x32, 0x4f, 0xcb, 0xde, 0x3f, 
+    0x12, 0x4e, 0xc0, 0x00, 0x20, 0xc0, 0x00, 0x80, 0x00, 0x03, 0x80, 0x00, 
+    0x03, 0x00, 0x02, 0x0c, 0x00, 0x02, 0x0c, 0x00, 0xdc, 0x32, 0x86, 0x04, 
+    0x57, 0xd1, 0x5b, 0x99, 0xe8, 0xf6, 0x79, 0x0f, 0xb5, 0xde, 0xef, 0xbf, 
+    0x8e, 0x11, 0xe2, 0x04, 0x0c, 0x00, 0x02, 0x0c, 0x00, 0x08, 0x30, 0x00, 
+    0x08, 0x30, 0x00, 0x08, 0x30, 0x00, 0x20, 0xc0, 0x00, 0xf0, 0x4a, 0x8c, 
+    0x21, 0x75, 0xa2, 0x95, 0x5b, 0x75, 0x5e, 0xd9, 0x6f, 0xb7, 0xf8, 0x44, 
+    0x9e, 0x0d, 0x4f, 0xe5, 0x37, 0x8e, 0x13, 0x30, 0x00, 0x20, 0xc0, 0x00, 
+    0x20, 0xc0, 0x00, 0x20, 0xc0, 0x00, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 
+    0x00, 0xc5, 0x18, 0x43, 0xa2, 0x69, 0x55, 0x6f, 0x98, 0xf9, 0xc3, 0x5a, 
+    0x2a, 0xca, 0x7e, 0xb7, 0x7b, 0x6b, 0xb4, 0x8f, 0x5d, 0xfe, 0x8e, 0x73, 
+    0x8c, 0x58, 0x39, 0x01, 0x03, 0x00, 0x02, 0x0c, 0x00, 0x02, 0x0c, 0x00, 
+    0x08, 0x30, 0x00, 0x08, 0x30, 0x00, 0x08, 0x30, 0x00, 0x50, 0x99, 0x5b, 
+    0x5c, 0x00, 0x9e, 0xc8, 0x18, 0x92, 0x13, 0x30, 0x00, 0x20, 0xc0, 0x00, 
+    0x20, 0xc0, 0x00, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x02, 0x0c, 
+    0x00, 0x7d, 0x30, 0x86, 0x04, 0x50, 0x80, 0x9b, 0xa3, 0x70, 0x02, 0x06, 
+    0x00, 0x01, 0x06, 0x00, 0x04, 0x18, 0x00, 0x04, 0x18, 0x00, 0x04, 0x18, 
+    0x00, 0x10, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x9a, 0xf1, 0x03, 0x9f, 0x81, 0xa9, 0x6a, 0x53, 0xb4, 0x4c, 
+    0xef, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 
+    0x82
+};
+
+/* difficulties.png */
+const unsigned char data_difficulties_png[3734] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 
+    0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x80, 
+    0x08, 0x06, 0x00, 0x00, 0x00, 0x42, 0xc2, 0xbc, 0xbe, 0x00, 0x00, 0x01, 
+    0x85, 0x69, 0x43, 0x43, 0x50, 0x49, 0x43, 0x43, 0x20, 0x70, 0x72, 0x6f, 
+    0x66, 0x69, 0x6c, 0x65, 0x00, 0x00, 0x28, 0x91, 0x7d, 0x91, 0x3b, 0x48, 
+    0xc3, 0x50, 0x14, 0x86, 0xff, 0xa6, 0xd6, 0x8a, 0x54, 0x1c, 0xec, 0x20, 
+    0xe2, 0x90, 0xa1, 0x3a, 0x88, 0x5d, 0x7c, 0xe1, 0x58, 0xab, 0x50, 0x84, 
+    0x0a, 0xa1, 0x56, 0x68, 0xd5, 0xc1, 0xe4, 0xa6, 0x2f, 0x68, 0xd2, 0x90, 
+    0xb4, 0xb8, 0x38, 0x0a, 0xae, 0x05, 0x07, 0x1f, 0x8b, 0x55, 0x07, 0x17, 
+    0x67, 0x5d, 0x1d, 0x5c, 0x05, 0x41, 0xf0, 0x01, 0xe2, 0xea, 0xe2, 0xa4, 
+    0xe8, 0x22, 0x25, 0x9e, 0x9b, 0x14, 0x5a, 0xc4, 0x78, 0xe1, 0x70, 0x3f, 
+    0xfe, 0x7b, 0xff, 0x9f, 0x73, 0xcf, 0x05, 0x84, 0x46, 0x99, 0x69, 0x56, 
+    0x57, 0x0c, 0xd0, 0xf4, 0xaa, 0x99, 0x4a, 0xc4, 0xc5, 0x4c, 0x76, 0x55, 
+    0x0c, 0xbe, 0x22, 0x80, 0x6e, 0xaa, 0x69, 0x8c, 0xc9, 0xcc, 0x32, 0xe6, 
+    0x24, 0x29, 0x09, 0xcf, 0xf5, 0x75, 0x0f, 0x1f, 0xdf, 0xef, 0xa2, 0x3c, 
+    0xcb, 0xfb, 0xde, 0x9f, 0xab, 0x4f, 0xcd, 0x59, 0x0c, 0xf0, 0x89, 0xc4, 
+    0x31, 0x66, 0x98, 0x55, 0xe2, 0x0d, 0xe2, 0x99, 0xcd, 0xaa, 0xc1, 0x79, 
+    0x9f, 0x38, 0xcc, 0x8a, 0xb2, 0x4a, 0x7c, 0x4e, 0x3c, 0x6e, 0x52, 0x83, 
+    0xc4, 0x8f, 0x5c, 0x57, 0x5c, 0x7e, 0xe3, 0x5c, 0x70, 0x58, 0xe0, 0x99, 
+    0x61, 0x33, 0x9d, 0x9a, 0x27, 0x0e, 0x13, 0x8b, 0x85, 0x0e, 0x56, 0x3a, 
+    0x98, 0x15, 0x4d, 0x8d, 0x78, 0x8a, 0x38, 0xa2, 0x6a, 0x3a, 0xe5, 0x0b, 
+    0x19, 0x97, 0x55, 0xce, 0x5b, 0x9c, 0xb5, 0x72, 0x8d, 0xb5, 0xfa, 0xe4, 
+    0x2f, 0x0c, 0xe5, 0xf4, 0x95, 0x65, 0xae, 0x53, 0x0d, 0x23, 0x81, 0x45, 
+    0x2c, 0x41, 0x82, 0x08, 0x05, 0x35, 0x94, 0x50, 0x46, 0x15, 0x51, 0xda, 
+    0x75, 0x52, 0x2c, 0xa4, 0xe8, 0x3c, 0xee, 0xe1, 0x1f, 0x72, 0xfc, 0x12, 
+    0xb9, 0x14, 0x72, 0x95, 0xc0, 0xc8, 0xb1, 0x80, 0x0a, 0x34, 0xc8, 0x8e, 
+    0x1f, 0xfc, 0x0f, 0x7e, 0xcf, 0xd6, 0xca, 0x4f, 0x4e, 0xb8, 0x49, 0xa1, 
+    0x38, 0x10, 0x78, 0xb1, 0xed, 0x8f, 0x11, 0x20, 0xb8, 0x0b, 0x34, 0xeb, 
+    0xb6, 0xfd, 0x7d, 0x6c, 0xdb, 0xcd, 0x13, 0xc0, 0xff, 0x0c, 0x5c, 0xe9, 
+    0x6d, 0x7f, 0xa5, 0x01, 0xcc, 0x7e, 0x92, 0x5e, 0x6f, 0x6b, 0x91, 0x23, 
+    0xa0, 0x7f, 0x1b, 0xb8, 0xb8, 0x6e, 0x6b, 0xca, 0x1e, 0x70, 0xb9, 0x03, 
+    0x0c, 0x3e, 0x19, 0xb2, 0x29, 0x3b, 0x92, 0x9f, 0x4a, 0xc8, 0xe7, 0x81, 
+    0xf7, 0x33, 0xfa, 0xa6, 0x2c, 0x30, 0x70, 0x0b, 0xf4, 0xae, 0xb9, 0x73, 
+    0x6b, 0x9d, 0xe3, 0xf4, 0x01, 0x48, 0xd3, 0xac, 0x92, 0x37, 0xc0, 0xc1, 
+    0x21, 0x30, 0x5a, 0xa0, 0xec, 0x75, 0x8f, 0x77, 0xf7, 0x74, 0xce, 0xed, 
+    0xdf, 0x3b, 0xad, 0xf9, 0xfd, 0x00, 0xb0, 0x21, 0x72, 0xbf, 0x4b, 0x2f, 
+    0xa7, 0x3f, 0x00, 0x00, 0x00, 0x06, 0x62, 0x4b, 0x47, 0x44, 0x00, 0xd0, 
+    0x00, 0x00, 0x00, 0x00, 0x70, 0xb6, 0xc4, 0x26, 0x00, 0x00, 0x00, 0x09, 
+    0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x2e, 0x23, 0x00, 0x00, 0x2e, 0x23, 
+    0x01, 0x78, 0xa5, 0x3f, 0x76, 0x00, 0x00, 0x00, 0x07, 0x74, 0x49, 0x4d, 
+    0x45, 0x07, 0xe7, 0x05, 0x06, 0x05, 0x35, 0x35, 0xd8, 0x57, 0x95, 0x48, 
+    0x00, 0x00, 0x00, 0x19, 0x74, 0x45, 0x58, 0x74, 0x43, 0x6f, 0x6d, 0x6d, 
+    0x65, 0x6e, 0x74, 0x00, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 
+    0x77, 0x69, 0x74, 0x68, 0x20, 0x47, 0x49, 0x4d, 0x50, 0x57, 0x81, 0x0e, 
+    0x17, 0x00, 0x00, 0x0c, 0x6d, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0xed, 
+    0xdd, 0x3f, 0xac, 0xdb, 0xc6, 0x19, 0x00, 0xf0, 0xef, 0x82, 0xa4, 0x30, 
+    0x90, 0xb9, 0x81, 0x01, 0x3f, 0x03, 0x1d, 0x3d, 0xc4, 0xce, 0x60, 0x07, 
+    0x76, 0xda, 0xcd, 0xd9, 0xea, 0x39, 0x99, 0x9b, 0xa9, 0x0e, 0x10, 0xc0, 
+    0x6f, 0xec, 0xd8, 0xa1, 0x7b, 0xe4, 0x2d, 0x99, 0x0a, 0x64, 0xed, 0xdc, 
+    0xf1, 0x75, 0x4b, 0xf1, 0x82, 0xd8, 0x43, 0x5e, 0x0a, 0xc4, 0x73, 0x2c, 
+    0x04, 0xf9, 0xb3, 0x74, 0x68, 0x81, 0x0e, 0x05, 0xae, 0x43, 0xf4, 0x92, 
+    0x33, 0x4b, 0x52, 0x24, 0x45, 0x4a, 0xa2, 0xf4, 0xfb, 0x01, 0x86, 0x9f, 
+    0xfe, 0xf0, 0x78, 0x77, 0x92, 0x3e, 0xde, 0x7d, 0x3c, 0x51, 0x11, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x4a, 0x9e, 0x98, 
+    0x1e, 0x3e, 0xa8, 0xf7, 0xca, 0xe9, 0x1c, 0x5e, 0xf7, 0xb9, 0xd4, 0x73, 
+    0x13, 0x2f, 0x79, 0x3b, 0xc2, 0xf1, 0x12, 0x00, 0xe0, 0x88, 0xbd, 0xac, 
+    0x0b, 0xd8, 0x81, 0x8b, 0x88, 0xf8, 0x58, 0x3d, 0x0f, 0x3b, 0x00, 0xfc, 
+    0x3b, 0x22, 0x9e, 0x79, 0xaf, 0xb3, 0x9a, 0x4f, 0x97, 0xf3, 0xe4, 0xc7, 
+    0x29, 0xa5, 0x87, 0x1d, 0xb7, 0x5b, 0x44, 0xc4, 0xa3, 0xcb, 0xdb, 0x29, 
+    0xa5, 0xa4, 0x9e, 0xf3, 0x08, 0x00, 0xff, 0x48, 0x29, 0xdd, 0xf3, 0xd6, 
+    0x07, 0x39, 0x00, 0x40, 0x00, 0x80, 0x71, 0x87, 0xeb, 0x85, 0x45, 0x8f, 
+    0xed, 0x16, 0x4e, 0x31, 0x0b, 0x00, 0x60, 0x04, 0xa0, 0x0b, 0xe0, 0x78, 
+    0x1d, 0xdc, 0x69, 0xc0, 0xae, 0x43, 0xba, 0x6a, 0x96, 0x36, 0xe7, 0x7c, 
+    0x1e, 0x11, 0x77, 0xdb, 0x9e, 0xb3, 0xe9, 0x3e, 0x87, 0xd4, 0xab, 0xa1, 
+    0xfc, 0xcf, 0x86, 0x26, 0x58, 0x37, 0x69, 0xe7, 0x86, 0xde, 0x2f, 0xfe, 
+    0xfe, 0x65, 0xce, 0xf9, 0xa3, 0x8e, 0xdb, 0xfd, 0xba, 0xe5, 0xb1, 0xf2, 
+    0x14, 0xdd, 0x95, 0xb2, 0xcc, 0x32, 0x7b, 0x9f, 0x73, 0xbe, 0x1f, 0x11, 
+    0xef, 0x16, 0xcf, 0x3d, 0x8b, 0x88, 0x2b, 0x5b, 0xac, 0xe7, 0xd1, 0xcd, 
+    0xc7, 0xf2, 0xea, 0x8d, 0xb6, 0x0f, 0xf5, 0xe8, 0xb4, 0x74, 0x33, 0xe7, 
+    0x7c, 0x3e, 0x74, 0x79, 0xe7, 0xd4, 0x4b, 0x9e, 0xc7, 0xec, 0xdb, 0x4d, 
+    0xda, 0x39, 0xe2, 0x6b, 0x74, 0x3a, 0xf6, 0x92, 0xf0, 0x6a, 0x99, 0x5d, 
+    0x1f, 0xdb, 0x76, 0x3d, 0x4d, 0x01, 0x00, 0x01, 0x00, 0x90, 0x03, 0x98, 
+    0xc2, 0xd3, 0x23, 0xd9, 0xe7, 0x6c, 0xa5, 0x94, 0x16, 0x11, 0xd1, 0xe9, 
+    0xb4, 0x5d, 0x75, 0x85, 0x5d, 0xd7, 0x32, 0x6b, 0x56, 0xf4, 0xa5, 0x7d, 
+    0xa8, 0xe7, 0x31, 0x05, 0x80, 0xbb, 0x43, 0xe7, 0x42, 0x1b, 0x24, 0xdf, 
+    0x3e, 0x4b, 0x29, 0xdd, 0x19, 0xb8, 0x6d, 0x4c, 0xbd, 0x4f, 0x30, 0x05, 
+    0x00, 0x4c, 0x01, 0x60, 0x62, 0xe5, 0x29, 0xc2, 0x4f, 0x75, 0x87, 0x11, 
+    0x00, 0x3b, 0x34, 0x74, 0xd9, 0x6e, 0x8f, 0xf2, 0x5f, 0x38, 0x65, 0x97, 
+    0x52, 0x7a, 0x78, 0xf9, 0x2f, 0x22, 0xae, 0x75, 0x3d, 0x45, 0x37, 0x75, 
+    0x3d, 0x8f, 0x69, 0x04, 0xb0, 0xef, 0x5f, 0x07, 0xae, 0x26, 0xee, 0x6e, 
+    0x44, 0xc4, 0xab, 0x1d, 0xb6, 0x7b, 0xb3, 0x72, 0xfb, 0x5f, 0x39, 0xe7, 
+    0x27, 0x43, 0x2a, 0x20, 0x77, 0xc0, 0x21, 0x07, 0x80, 0xbd, 0xfe, 0x3a, 
+    0x70, 0xf5, 0xc3, 0x57, 0xb7, 0x42, 0xae, 0x61, 0xbb, 0x27, 0x35, 0x47, 
+    0x8d, 0xdb, 0x13, 0xd7, 0x75, 0xd0, 0xea, 0xc0, 0x1d, 0xae, 0xfa, 0x43, 
+    0x00, 0x80, 0x17, 0x0c, 0x5d, 0x62, 0xfb, 0x49, 0xd3, 0x48, 0xb2, 0x52, 
+    0xc6, 0x0f, 0x95, 0x7d, 0x94, 0xce, 0xca, 0xc7, 0x72, 0xce, 0xef, 0x44, 
+    0xc4, 0xdb, 0x45, 0x50, 0x7c, 0x38, 0x65, 0x3d, 0x8f, 0x71, 0x8e, 0xb7, 
+    0x95, 0xa5, 0xc0, 0xfb, 0xb2, 0x44, 0x76, 0x17, 0xcb, 0x45, 0xbb, 0xb4, 
+    0x7d, 0x1f, 0x96, 0xfd, 0x76, 0x99, 0xaf, 0x0f, 0xed, 0xa3, 0xa9, 0xbf, 
+    0x0e, 0xec, 0xaa, 0xc0, 0x80, 0x29, 0xc0, 0x81, 0x8e, 0x58, 0xaa, 0x73, 
+    0xf9, 0x1b, 0x63, 0xce, 0xd1, 0x3b, 0xd6, 0xe1, 0xcf, 0x11, 0x71, 0xb3, 
+    0x2d, 0x37, 0x01, 0xa6, 0x00, 0x13, 0xec, 0x73, 0x1f, 0x86, 0x75, 0x23, 
+    0x4f, 0x3b, 0x66, 0x33, 0x05, 0xc0, 0x14, 0x00, 0x10, 0x00, 0x00, 0x01, 
+    0x00, 0xd8, 0x89, 0x29, 0x93, 0x80, 0xaf, 0x0f, 0x5d, 0x21, 0x57, 0xa7, 
+    0x2e, 0x39, 0xd6, 0xb0, 0x40, 0xe6, 0x49, 0xc7, 0xf2, 0xd6, 0x5e, 0x12, 
+    0xac, 0x61, 0xee, 0x3d, 0x69, 0x9b, 0x7a, 0x6c, 0x5b, 0xad, 0xff, 0xbd, 
+    0xea, 0x1c, 0xdf, 0xa2, 0x1f, 0x76, 0x19, 0x00, 0x5e, 0x8d, 0x88, 0xdb, 
+    0x3b, 0x68, 0xd3, 0xed, 0x99, 0x97, 0x0f, 0xa6, 0x00, 0x80, 0x00, 0x00, 
+    0x08, 0x00, 0xc0, 0x5e, 0xe7, 0x00, 0xf6, 0x25, 0xe1, 0x34, 0xb4, 0x1e, 
+    0x5d, 0xbf, 0xb9, 0x28, 0xb1, 0x86, 0x11, 0x00, 0x20, 0x00, 0x00, 0x02, 
+    0x00, 0x20, 0x00, 0x00, 0x73, 0xe3, 0x8a, 0x40, 0x33, 0xd0, 0x71, 0xf5, 
+    0xe1, 0x97, 0x53, 0x24, 0x28, 0x5b, 0xbe, 0x41, 0x78, 0x3d, 0xa5, 0xb4, 
+    0x5c, 0xb3, 0xed, 0x32, 0x22, 0xae, 0x55, 0xef, 0x1f, 0xab, 0x9e, 0x45, 
+    0xdd, 0x6a, 0xeb, 0x92, 0x73, 0x3e, 0x89, 0x88, 0xe7, 0x63, 0xee, 0x53, 
+    0x00, 0x60, 0x17, 0xba, 0xac, 0x3e, 0xfc, 0xaf, 0x6e, 0x42, 0x00, 0x60, 
+    0x6c, 0xd5, 0xab, 0x20, 0x7f, 0xde, 0xe3, 0xc8, 0xfc, 0x20, 0x22, 0xbe, 
+    0xdf, 0xc2, 0x91, 0xf9, 0xf9, 0x6a, 0x97, 0x6f, 0xa5, 0x94, 0xce, 0x9b, 
+    0x46, 0x1e, 0x08, 0x00, 0xf4, 0x54, 0xbd, 0x0a, 0x72, 0xcf, 0x6b, 0x8a, 
+    0x5c, 0xb4, 0x0c, 0xcd, 0xd9, 0x03, 0x92, 0x80, 0x1c, 0x95, 0x21, 0x17, 
+    0x6d, 0x2d, 0xee, 0x3a, 0x59, 0xdd, 0x3e, 0xef, 0x71, 0xe1, 0xd2, 0xe5, 
+    0x80, 0x8b, 0x9d, 0x2e, 0xb7, 0x75, 0xb5, 0x2a, 0x23, 0x80, 0x79, 0x1c, 
+    0x85, 0x25, 0xb0, 0x30, 0x05, 0x60, 0xbe, 0x47, 0xdd, 0xd5, 0x9f, 0x6b, 
+    0xcf, 0x1c, 0x0c, 0x74, 0x3d, 0xa5, 0xb4, 0x5c, 0x1d, 0x99, 0xef, 0x16, 
+    0xb7, 0x7f, 0xca, 0x35, 0x74, 0xc8, 0x69, 0xd4, 0xe6, 0x2b, 0x1a, 0x72, 
+    0x0d, 0xef, 0x45, 0xc4, 0x07, 0x6d, 0x39, 0x8d, 0x21, 0x79, 0x90, 0x75, 
+    0xdb, 0x08, 0x00, 0x30, 0x5d, 0x4e, 0xe3, 0xa2, 0x47, 0x70, 0x7a, 0x56, 
+    0x96, 0xb3, 0x26, 0xa7, 0x31, 0x24, 0x0f, 0x72, 0x31, 0x51, 0xa0, 0x14, 
+    0x00, 0xd8, 0x89, 0xcb, 0xa3, 0xee, 0x77, 0x33, 0x6f, 0xc7, 0xe5, 0x91, 
+    0xf9, 0xab, 0x1e, 0xdb, 0xdc, 0xca, 0x39, 0x5f, 0xad, 0xb9, 0xff, 0xb5, 
+    0x96, 0x7e, 0xba, 0x5a, 0xb7, 0x4d, 0xdd, 0xcf, 0xd2, 0x09, 0x00, 0xcc, 
+    0xee, 0xa8, 0x3b, 0x63, 0x43, 0x8e, 0xcc, 0x7f, 0xed, 0xdb, 0x4f, 0x2d, 
+    0xa7, 0x31, 0x93, 0x00, 0x00, 0xcd, 0x1f, 0xa0, 0x7b, 0x07, 0xd2, 0x94, 
+    0x2f, 0x22, 0xe2, 0xdb, 0x9a, 0x69, 0xc3, 0x2b, 0x11, 0xf1, 0xc6, 0x98, 
+    0x41, 0x55, 0x00, 0x80, 0x69, 0xf5, 0x4e, 0x7c, 0xa6, 0x94, 0x1e, 0xd4, 
+    0xdd, 0xbf, 0xca, 0x1b, 0x7c, 0x3e, 0xe6, 0x68, 0x40, 0x00, 0xa0, 0x55, 
+    0xce, 0xf9, 0x4e, 0xd7, 0xb9, 0x6d, 0x71, 0x54, 0x7a, 0xba, 0xfa, 0xff, 
+    0x46, 0xc3, 0xfc, 0xf7, 0xeb, 0xe2, 0x39, 0x73, 0x68, 0xcf, 0x10, 0xeb, 
+    0xfa, 0xa0, 0x6e, 0xe8, 0xbf, 0xee, 0x2a, 0xd1, 0x3b, 0xeb, 0x37, 0x8e, 
+    0x37, 0x00, 0x0c, 0xfe, 0xb5, 0xe3, 0x21, 0x8b, 0x60, 0x06, 0xd6, 0xed, 
+    0xa4, 0xe9, 0x88, 0xd9, 0xb2, 0xa8, 0x67, 0xf0, 0x42, 0xa0, 0x2e, 0xfb, 
+    0x59, 0xd7, 0x07, 0x6b, 0xf6, 0xb3, 0xb5, 0x9f, 0xaa, 0xb3, 0x12, 0x10, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0xe8, 0x21, 0x77, 0xb7, 0x18, 0x58, 0xfe, 0x69, 0xd7, 0x1d, 0x68, 
+    0xfb, 0xe6, 0x5e, 0xf2, 0x96, 0x86, 0xe3, 0x25, 0x00, 0xc0, 0x11, 0x7b, 
+    0x59, 0x17, 0xd0, 0xd3, 0xc7, 0x2d, 0x8f, 0xfd, 0x7e, 0xe0, 0xd0, 0xf7, 
+    0xa3, 0x1e, 0xfb, 0x28, 0xb7, 0x7b, 0x27, 0x22, 0xde, 0xbe, 0xbc, 0x9d, 
+    0x52, 0x7a, 0xa8, 0xed, 0xb0, 0x1f, 0xf9, 0x81, 0xc5, 0x16, 0xb6, 0x5b, 
+    0xec, 0x32, 0x27, 0x70, 0x08, 0x6d, 0x37, 0x05, 0x00, 0x39, 0x00, 0x40, 
+    0x00, 0x80, 0x19, 0x49, 0x29, 0x9d, 0xa6, 0xc2, 0xa1, 0x4d, 0x2b, 0x86, 
+    0xb6, 0x5d, 0x00, 0x00, 0x04, 0x00, 0xa0, 0x9d, 0xd3, 0x80, 0xec, 0x9b, 
+    0xfb, 0x35, 0xa7, 0xc6, 0x9a, 0x86, 0xc1, 0x6d, 0xa7, 0xbe, 0xca, 0xd3, 
+    0x69, 0x57, 0xca, 0x32, 0xcb, 0xed, 0x72, 0xce, 0xf7, 0x23, 0xe2, 0xdd, 
+    0xe2, 0xb9, 0x67, 0x11, 0x71, 0x65, 0xe6, 0x6d, 0x87, 0xed, 0x1b, 0xe9, 
+    0x54, 0x58, 0x1e, 0x7b, 0x39, 0x6c, 0x75, 0x89, 0x6d, 0xd7, 0xc7, 0x0e, 
+    0xa1, 0xed, 0x1b, 0x4f, 0x01, 0x0e, 0x3d, 0x99, 0x32, 0x97, 0x7a, 0x82, 
+    0x1c, 0x00, 0x20, 0x00, 0x70, 0xd0, 0x1e, 0xa7, 0x8e, 0xba, 0x8e, 0xde, 
+    0x52, 0x4a, 0x8b, 0xca, 0x76, 0xe5, 0x36, 0xbf, 0x1a, 0xe3, 0x74, 0xda, 
+    0xbe, 0xb6, 0x5d, 0x00, 0x00, 0x46, 0x0b, 0x00, 0x8f, 0x2a, 0x39, 0x81, 
+    0x93, 0x96, 0x64, 0xca, 0x23, 0xdd, 0x0b, 0xfb, 0xcd, 0x69, 0x40, 0x8e, 
+    0x51, 0x79, 0x8a, 0xf0, 0x53, 0x01, 0x00, 0x0e, 0x58, 0xce, 0xf9, 0x34, 
+    0x22, 0x3e, 0x2c, 0x72, 0x02, 0xa9, 0x3a, 0x72, 0xad, 0x7b, 0xcc, 0x14, 
+    0x60, 0x4b, 0x2f, 0xce, 0x14, 0xe7, 0x3e, 0x47, 0x3a, 0x7f, 0x3c, 0x8a, 
+    0x96, 0x32, 0x47, 0x39, 0xad, 0x7a, 0xe8, 0xa7, 0x6a, 0x39, 0xe0, 0x00, 
+    0x00, 0x98, 0x02, 0x30, 0x9f, 0xe1, 0xf4, 0x47, 0x1d, 0x9f, 0xda, 0xba, 
+    0xac, 0xb5, 0x5c, 0xca, 0x5a, 0x19, 0x92, 0xf7, 0x5d, 0x0e, 0x7b, 0xda, 
+    0xa1, 0x9e, 0x3f, 0x44, 0xc4, 0xfb, 0x0d, 0xc5, 0x9c, 0x95, 0x8f, 0xb5, 
+    0x5d, 0x69, 0x67, 0x2e, 0x6d, 0xef, 0x23, 0x75, 0x78, 0xc1, 0xdb, 0x86, 
+    0x86, 0xd7, 0x53, 0x4a, 0xcb, 0xba, 0x79, 0x56, 0x4d, 0x85, 0x53, 0x43, 
+    0xf9, 0xd5, 0xb5, 0xd8, 0xd1, 0xa5, 0xe3, 0xd6, 0xbc, 0xe0, 0x67, 0xe5, 
+    0x8b, 0xb8, 0xc6, 0xaf, 0x23, 0xe2, 0x66, 0xc3, 0x0b, 0xd2, 0xf6, 0x62, 
+    0x94, 0x97, 0x80, 0xfa, 0x32, 0x22, 0xfe, 0xde, 0xa5, 0xde, 0x95, 0xfe, 
+    0x7c, 0x9c, 0x52, 0x3a, 0xed, 0xf8, 0xc1, 0x5b, 0x44, 0x71, 0x66, 0xa5, 
+    0x52, 0xcf, 0xdc, 0x52, 0x97, 0x3f, 0xa4, 0x94, 0xfe, 0xd9, 0xd0, 0xd7, 
+    0x8d, 0x6d, 0x1f, 0xf8, 0x7e, 0xe8, 0xfe, 0xc6, 0x6b, 0x7e, 0x3f, 0xb4, 
+    0xbe, 0x8f, 0xba, 0x94, 0xb1, 0xa5, 0x7e, 0xde, 0xdb, 0xb6, 0x4f, 0x39, 
+    0x02, 0x78, 0xa1, 0x23, 0x73, 0xce, 0xcb, 0x9c, 0xf3, 0xb5, 0xe2, 0xb1, 
+    0xd4, 0xd4, 0x91, 0x6b, 0x5e, 0x9c, 0x87, 0x9b, 0xbe, 0x38, 0x95, 0x0f, 
+    0xe4, 0x7f, 0xd6, 0x04, 0x8b, 0x3c, 0x42, 0xc0, 0x29, 0xf7, 0xf7, 0xb7, 
+    0xae, 0x6f, 0xb0, 0x2d, 0xb8, 0x59, 0x7e, 0xa8, 0x23, 0xe2, 0x4f, 0x11, 
+    0xf1, 0xcf, 0xd5, 0xdf, 0xb7, 0x62, 0xe0, 0xb5, 0xeb, 0x90, 0x03, 0x00, 
+    0xe4, 0x00, 0x38, 0x66, 0x53, 0x9f, 0x26, 0x4b, 0x29, 0x2d, 0x22, 0x62, 
+    0xb1, 0xab, 0x7a, 0xae, 0x46, 0x72, 0xa7, 0x73, 0x6e, 0xfb, 0xdc, 0x46, 
+    0x00, 0x8f, 0x7a, 0x9c, 0x4e, 0x7b, 0x34, 0xd6, 0x9b, 0xb8, 0x58, 0xfb, 
+    0xfd, 0xf8, 0xc0, 0x3e, 0xa3, 0x8f, 0x2b, 0xed, 0x3b, 0x6f, 0x59, 0xf7, 
+    0x7e, 0x68, 0x6d, 0xc7, 0x14, 0x00, 0x10, 0x00, 0x80, 0x59, 0xe4, 0x00, 
+    0x5a, 0x4f, 0xa1, 0x01, 0x7b, 0x1a, 0x00, 0x52, 0x4a, 0x27, 0x23, 0xd4, 
+    0x61, 0xeb, 0xa7, 0xd0, 0x2c, 0x7b, 0x05, 0x53, 0x00, 0x10, 0x00, 0x74, 
+    0x01, 0x98, 0x02, 0x6c, 0x5b, 0xb9, 0x2e, 0xfb, 0x97, 0x3d, 0xd6, 0x58, 
+    0x57, 0xa7, 0x20, 0x0f, 0x1b, 0xca, 0xbc, 0x58, 0x53, 0x66, 0xf9, 0xdc, 
+    0x77, 0x22, 0xe2, 0x7e, 0xc3, 0x54, 0x61, 0xf6, 0x6b, 0xbf, 0x47, 0x9a, 
+    0xa6, 0x71, 0xac, 0xa6, 0xfe, 0xaa, 0x69, 0x9f, 0xaf, 0x03, 0xf7, 0xf9, 
+    0x5a, 0x6f, 0x8f, 0xaf, 0xe7, 0x76, 0xfd, 0x9a, 0x6d, 0x1e, 0xbb, 0x9e, 
+    0x63, 0x7d, 0x15, 0xda, 0xd7, 0x81, 0x31, 0x05, 0x00, 0x04, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0xb6, 0xa3, 0xee, 0x77, 0x23, 0x6a, 0x9e, 0xb3, 0x9c, 
+    0xf2, 0x47, 0x2f, 0xd7, 0xd5, 0x21, 0xe7, 0x7c, 0xe2, 0xec, 0x87, 0xeb, 
+    0x01, 0x30, 0xee, 0x07, 0xff, 0x56, 0x44, 0xfc, 0x42, 0x4f, 0xcc, 0x47, 
+    0xd2, 0x05, 0x8c, 0x18, 0x00, 0x96, 0x11, 0x71, 0xad, 0xb8, 0xeb, 0xa7, 
+    0x6b, 0x46, 0x96, 0x47, 0xe6, 0xd5, 0x9f, 0x0f, 0x22, 0xe2, 0xfb, 0x9a, 
+    0x62, 0xbe, 0x8d, 0x88, 0xe7, 0x11, 0x9b, 0x5d, 0x80, 0xa3, 0xe6, 0xc8, 
+    0xfe, 0x56, 0x4a, 0xe9, 0xbc, 0xa6, 0x8e, 0x47, 0xf7, 0x5b, 0x00, 0x46, 
+    0x00, 0xec, 0x83, 0x8b, 0x6a, 0x70, 0xb8, 0x1c, 0x9a, 0xeb, 0x9a, 0xed, 
+    0xb1, 0x0e, 0x80, 0x51, 0x8e, 0xfc, 0xab, 0x23, 0xee, 0xbd, 0x39, 0x1f, 
+    0x4d, 0x87, 0xac, 0xee, 0xac, 0xe6, 0x1a, 0x72, 0xce, 0xe7, 0x3d, 0x56, 
+    0x70, 0x2e, 0x07, 0xac, 0xfa, 0x5c, 0x8e, 0xf9, 0x03, 0x3a, 0x02, 0x00, 
+    0x1c, 0x31, 0x53, 0x00, 0x36, 0x39, 0x62, 0x3e, 0x59, 0xfd, 0xf9, 0xbb, 
+    0xf8, 0xf1, 0xd2, 0xe3, 0xdf, 0x6d, 0x30, 0x57, 0xbf, 0x5e, 0x37, 0x25, 
+    0x18, 0xc1, 0xf5, 0x94, 0xd2, 0x72, 0x75, 0x64, 0xbe, 0x5b, 0xdc, 0x3e, 
+    0xb9, 0xcc, 0x35, 0x14, 0xde, 0xac, 0xdc, 0xfe, 0x7c, 0x4d, 0xbe, 0xa2, 
+    0xf4, 0x7c, 0xd5, 0x94, 0xf7, 0x22, 0xe2, 0x83, 0xca, 0x94, 0xe6, 0x85, 
+    0x9c, 0xc6, 0xba, 0x3c, 0xc8, 0x90, 0x6d, 0x04, 0x00, 0x76, 0xe1, 0xf6, 
+    0xea, 0xff, 0x67, 0x13, 0x7d, 0x78, 0xb7, 0x2a, 0xa5, 0xf4, 0xa4, 0xf2, 
+    0x41, 0x6c, 0xcd, 0x57, 0x34, 0x78, 0x56, 0x96, 0xb3, 0x26, 0xa7, 0x31, 
+    0x24, 0x0f, 0x72, 0x31, 0x66, 0x5f, 0x0b, 0x00, 0x8c, 0xe1, 0x56, 0xce, 
+    0xf9, 0x6a, 0xcb, 0xfd, 0xdf, 0xa4, 0x94, 0xbe, 0x69, 0xd8, 0xf6, 0xf2, 
+    0xa8, 0xfb, 0xdd, 0xcc, 0xfb, 0xe0, 0xf2, 0xc8, 0xfc, 0xd5, 0x08, 0xfd, 
+    0xf6, 0x5a, 0x4b, 0x3f, 0x5d, 0xad, 0xdb, 0xa6, 0x1a, 0xbc, 0x60, 0x1b, 
+    0x53, 0x80, 0xae, 0xfe, 0x58, 0xb3, 0xcd, 0xa4, 0x0b, 0x74, 0x5a, 0x92, 
+    0x73, 0x27, 0x5d, 0xf7, 0xd3, 0x71, 0x41, 0x53, 0xef, 0xf6, 0x6c, 0xf2, 
+    0x55, 0xf2, 0xb1, 0x17, 0x50, 0x19, 0x01, 0x70, 0x14, 0x52, 0x4a, 0xf7, 
+    0x0e, 0xa4, 0x29, 0x5f, 0xc4, 0x8f, 0x6b, 0x25, 0xaa, 0x81, 0xe1, 0x95, 
+    0x88, 0x78, 0xa3, 0xef, 0x68, 0x40, 0x00, 0x60, 0x93, 0x0f, 0x55, 0xd3, 
+    0x8f, 0x5c, 0x4e, 0x9d, 0xd8, 0x3b, 0x14, 0xbd, 0xfb, 0x27, 0xa5, 0xf4, 
+    0xa0, 0x69, 0xa4, 0x11, 0x3f, 0x27, 0x2d, 0x93, 0x00, 0xc0, 0xbe, 0x7a, 
+    0xba, 0xfa, 0xff, 0x46, 0xc3, 0xfc, 0xf7, 0xeb, 0xe2, 0x39, 0xdb, 0x9e, 
+    0xd2, 0xdc, 0xe9, 0x3a, 0x57, 0xdf, 0x70, 0xce, 0xbd, 0xae, 0x0f, 0xfe, 
+    0x6f, 0x3f, 0x2d, 0x75, 0xdb, 0x79, 0xbf, 0xc1, 0x90, 0xb9, 0xf3, 0xde, 
+    0x7d, 0x19, 0x68, 0x8c, 0x85, 0x40, 0x7d, 0x72, 0x1a, 0x7d, 0x16, 0xf5, 
+    0x8c, 0xb9, 0xf8, 0xa7, 0x64, 0x21, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x99, 0x9c, 0xf3, 0x69, 
+    0xee, 0x68, 0x97, 0x65, 0x6a, 0x7b, 0xb3, 0x97, 0xbc, 0x8d, 0xe1, 0x78, 
+    0x8d, 0x16, 0x00, 0x6a, 0x82, 0xd4, 0xf9, 0x06, 0x65, 0x9d, 0xef, 0x53, 
+    0xb4, 0x3f, 0xb0, 0xa3, 0xb6, 0xbe, 0xe5, 0x27, 0x2f, 0xeb, 0x02, 0x36, 
+    0x70, 0x11, 0x11, 0x1f, 0x8f, 0x71, 0xf0, 0x28, 0x6e, 0x7e, 0xd9, 0xb5, 
+    0xcc, 0x9c, 0xf3, 0x22, 0x22, 0x1e, 0x5d, 0xde, 0x4e, 0x29, 0x25, 0x6d, 
+    0xdf, 0xdd, 0x91, 0xc5, 0x08, 0xe0, 0x08, 0x46, 0x00, 0x95, 0x4d, 0x17, 
+    0x3d, 0xb6, 0x5b, 0x34, 0xed, 0x73, 0x8a, 0x32, 0xb7, 0xf0, 0x1e, 0x3f, 
+    0x88, 0xb6, 0xcb, 0x01, 0x80, 0x1c, 0x00, 0x20, 0x07, 0x00, 0xeb, 0x95, 
+    0x73, 0xd4, 0x4f, 0xf7, 0x78, 0xaa, 0x53, 0x0e, 0x8b, 0x1f, 0xa7, 0x94, 
+    0x4e, 0x47, 0x98, 0x5b, 0xcf, 0xa2, 0xed, 0x02, 0x00, 0x93, 0x49, 0x29, 
+    0x3d, 0xd4, 0x76, 0x53, 0x00, 0xc0, 0x08, 0x00, 0x1a, 0x87, 0xd2, 0xf7, 
+    0x23, 0xe2, 0xdd, 0xe2, 0xae, 0x4f, 0x22, 0xe2, 0xd9, 0x80, 0x72, 0x3e, 
+    0x2a, 0x6e, 0x9e, 0xa5, 0x94, 0xfe, 0x32, 0x60, 0xaa, 0x72, 0xa5, 0x2c, 
+    0xa7, 0x3c, 0x92, 0xd7, 0xd4, 0xf3, 0x2c, 0x22, 0xae, 0xcc, 0xbc, 0xed, 
+    0xbb, 0x99, 0x73, 0x39, 0x0d, 0x38, 0x8b, 0x0f, 0xe6, 0x56, 0xfa, 0xb6, 
+    0xba, 0xac, 0xb5, 0xc7, 0x7b, 0x67, 0xd1, 0xe3, 0xb1, 0x4e, 0xa7, 0xc2, 
+    0xda, 0xea, 0xd2, 0xa7, 0x9e, 0x73, 0x6c, 0xfb, 0xd1, 0x8d, 0x00, 0xba, 
+    0x76, 0x46, 0x75, 0xe1, 0xc4, 0x2a, 0x60, 0xdd, 0x6d, 0x7b, 0x4e, 0x43, 
+    0xf9, 0x9f, 0xa5, 0x94, 0xee, 0x4d, 0x55, 0xaf, 0x6d, 0x95, 0xc7, 0x71, 
+    0x92, 0x03, 0x00, 0x01, 0x00, 0xc6, 0x9d, 0x06, 0x46, 0xc4, 0xaf, 0x52, 
+    0x61, 0x68, 0x99, 0xe9, 0x45, 0xa7, 0x03, 0xcb, 0x58, 0x94, 0x85, 0x4c, 
+    0x51, 0xcf, 0x7d, 0x6d, 0xbb, 0x00, 0x00, 0x1c, 0x4f, 0x0e, 0x20, 0x22, 
+    0x9e, 0x1e, 0x49, 0xbd, 0x9e, 0x7a, 0xfb, 0xb2, 0xcf, 0x01, 0xe0, 0xee, 
+    0xd4, 0xd9, 0xfb, 0x86, 0x84, 0xdc, 0x9d, 0x81, 0xdb, 0x8e, 0x59, 0xaf, 
+    0xd3, 0x88, 0xf8, 0xb0, 0x3a, 0x9c, 0x3b, 0xc0, 0x76, 0xde, 0x8c, 0x88, 
+    0xdf, 0x14, 0x77, 0xcd, 0x65, 0xa5, 0xdc, 0xc6, 0xf5, 0x9c, 0x71, 0xdb, 
+    0x0f, 0x7e, 0x04, 0xc0, 0xf6, 0xbc, 0x5d, 0x06, 0xba, 0x7d, 0x3d, 0xe3, 
+    0x50, 0x0d, 0xc8, 0x65, 0x3d, 0x2f, 0x4f, 0xd9, 0x0d, 0x68, 0xc3, 0x2c, 
+    0xda, 0x2e, 0x07, 0x00, 0x08, 0x00, 0xc0, 0x76, 0xa7, 0x00, 0xff, 0x8e, 
+    0x01, 0xcb, 0x1f, 0x57, 0x6e, 0x44, 0xc4, 0xab, 0x13, 0xb7, 0xfd, 0xe9, 
+    0x48, 0xfb, 0x7c, 0x3d, 0xe7, 0xfc, 0xa4, 0x72, 0xdf, 0x59, 0x44, 0xbc, 
+    0xb9, 0x27, 0xaf, 0xf1, 0xd3, 0x31, 0xfb, 0xb6, 0xb2, 0x3c, 0xf5, 0x66, 
+    0xcb, 0x63, 0xad, 0xca, 0xe5, 0xb8, 0x95, 0x21, 0xf9, 0xfd, 0xae, 0xe5, 
+    0xac, 0xca, 0x38, 0xed, 0x50, 0xcf, 0x1f, 0x22, 0xe2, 0xfd, 0x86, 0x62, 
+    0xce, 0xca, 0xc7, 0x72, 0xce, 0xef, 0xac, 0x86, 0xf7, 0xff, 0x57, 0xcf, 
+    0xb9, 0xb4, 0x7d, 0x57, 0xf3, 0xac, 0xad, 0x2f, 0x05, 0xde, 0x93, 0x7d, 
+    0xd6, 0x59, 0xcc, 0xbd, 0x6f, 0x7b, 0xd4, 0x65, 0x90, 0xb6, 0xf9, 0xfa, 
+    0x18, 0x57, 0xc6, 0xdd, 0xc2, 0xd5, 0x7b, 0xf6, 0xb6, 0xed, 0xa6, 0x00, 
+    0x80, 0x00, 0x00, 0x98, 0x02, 0x98, 0x02, 0x8c, 0x38, 0x05, 0xe0, 0xb0, 
+    0xbc, 0x7c, 0xc4, 0x01, 0xab, 0x9a, 0xb8, 0xbb, 0x31, 0xb0, 0xa8, 0x4e, 
+    0xdf, 0x06, 0x3c, 0x80, 0x76, 0x22, 0x00, 0x1c, 0x94, 0xdb, 0xda, 0x89, 
+    0x1c, 0x00, 0x20, 0x00, 0x00, 0x02, 0x00, 0x20, 0x07, 0x30, 0x0f, 0x0d, 
+    0x97, 0xec, 0x7a, 0x32, 0x64, 0xdb, 0xba, 0x4b, 0x82, 0x69, 0x27, 0x02, 
+    0xc0, 0xfc, 0x48, 0xee, 0x81, 0x29, 0x00, 0x20, 0x00, 0x00, 0x02, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xe4, 0x9c, 0x97, 0x03, 0x2e, 
+    0xd3, 0xb5, 0x9c, 0xf2, 0xf2, 0x56, 0x45, 0x91, 0x27, 0x0d, 0x8f, 0x9f, 
+    0xb8, 0x06, 0xc2, 0x8b, 0x9c, 0x06, 0x84, 0x23, 0xe6, 0xa7, 0xa3, 0xe9, 
+    0x7d, 0x94, 0x5d, 0xfd, 0xf9, 0x20, 0x22, 0xbe, 0xaf, 0x79, 0xca, 0xb7, 
+    0x11, 0xf1, 0x3c, 0xe2, 0xe7, 0xef, 0x21, 0x0c, 0xd9, 0x66, 0xc3, 0xba, 
+    0x5d, 0x7a, 0x2b, 0xa5, 0x74, 0x9e, 0x73, 0x5e, 0x46, 0xc4, 0xb5, 0x17, 
+    0xde, 0xf8, 0x7e, 0x36, 0x3d, 0x22, 0xfc, 0x32, 0x10, 0xc3, 0x5d, 0xa4, 
+    0x94, 0x96, 0x75, 0xc3, 0xec, 0x91, 0xb7, 0xc1, 0x14, 0x00, 0xa6, 0x1b, 
+    0xd1, 0xf4, 0xbd, 0x14, 0x77, 0x35, 0xd7, 0x50, 0xbd, 0xce, 0xe2, 0x9a, 
+    0xfd, 0x8d, 0x96, 0x3b, 0x19, 0x23, 0x8f, 0x22, 0x00, 0x80, 0x29, 0x00, 
+    0x74, 0x53, 0xcc, 0xeb, 0x97, 0x39, 0xe7, 0x6b, 0x0d, 0x8f, 0xa7, 0x8e, 
+    0x73, 0xf5, 0xeb, 0x75, 0x53, 0x82, 0x11, 0x5c, 0x4f, 0x29, 0x2d, 0x57, 
+    0x47, 0xe6, 0xbb, 0xc5, 0xed, 0x93, 0xcb, 0x5c, 0x43, 0xa1, 0xfa, 0x0b, 
+    0x4e, 0x9f, 0xaf, 0xc9, 0x57, 0x94, 0x9e, 0xaf, 0x9a, 0xf2, 0x5e, 0x44, 
+    0x7c, 0x50, 0x99, 0xd2, 0xf4, 0xca, 0x83, 0x0c, 0xd9, 0x46, 0x00, 0x80, 
+    0xcd, 0x03, 0xda, 0x93, 0xca, 0x07, 0xb1, 0x35, 0x5f, 0xd1, 0xe0, 0x59, 
+    0x59, 0xce, 0x04, 0x79, 0x90, 0x8b, 0x89, 0x02, 0xa5, 0x00, 0xc0, 0x60, 
+    0xbf, 0x8d, 0x88, 0x5f, 0x0c, 0xdc, 0xf6, 0xf2, 0xa8, 0xfb, 0xdd, 0xcc, 
+    0xfb, 0xe0, 0xf2, 0xc8, 0xfc, 0x55, 0x8f, 0x6d, 0x6e, 0xe5, 0x9c, 0xaf, 
+    0xd6, 0xdc, 0xff, 0x5a, 0x4b, 0x3f, 0x5d, 0xad, 0xdb, 0xa6, 0x1a, 0xbc, 
+    0x04, 0x00, 0x26, 0xb7, 0x6e, 0xf8, 0x5e, 0x37, 0x94, 0x9d, 0xe2, 0x8d, 
+    0xbb, 0x27, 0x86, 0x1c, 0x99, 0xff, 0xda, 0x77, 0x74, 0x52, 0x77, 0x1a, 
+    0xf3, 0xf2, 0x29, 0x02, 0x00, 0x34, 0x7f, 0x80, 0xee, 0x1d, 0x48, 0x53, 
+    0xbe, 0x88, 0x1f, 0xd7, 0x4a, 0x54, 0x83, 0xed, 0x2b, 0x11, 0xf1, 0xc6, 
+    0x26, 0x41, 0x55, 0x00, 0x80, 0xed, 0xea, 0x9d, 0xf8, 0x4c, 0x29, 0x3d, 
+    0x68, 0x18, 0x8d, 0x9d, 0xc4, 0xcf, 0x49, 0xcb, 0x24, 0x00, 0xb0, 0x0d, 
+    0x4f, 0x57, 0xff, 0xdf, 0x68, 0x98, 0xcb, 0x7e, 0x5d, 0x3c, 0x67, 0x93, 
+    0x6d, 0xb6, 0x35, 0xa5, 0xb9, 0xd3, 0x75, 0xae, 0xbe, 0xe1, 0xd4, 0x65, 
+    0x5d, 0x1f, 0xd4, 0x0d, 0xfd, 0xef, 0xac, 0x29, 0x73, 0x67, 0xfd, 0x86, 
+    0x5c, 0xc0, 0x41, 0x7c, 0x19, 0x68, 0x8c, 0x85, 0x40, 0x5d, 0xf6, 0xb3, 
+    0xae, 0x0f, 0xd6, 0xec, 0x27, 0x4f, 0xd5, 0x6f, 0x16, 0x02, 0x01, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xc0, 0x40, 0xff, 0x03, 0x5f, 0x59, 0xdf, 0x6a, 0x88, 0xe0, 
+    0xc3, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 
+    0x60, 0x82
+};
+
@@ -0,0 +1,34 @@
+/* AUTOMATICALLY GENERATED HEADER FILE */
+
+#ifndef __DATA_GEN_H__
+#define __DATA_GEN_H__
+
+/* tile_closed.png */
+extern const unsigned char data_tile_closed_png[589];
+
+/* tile_open.png */
+extern const unsigned char data_tile_open_png[560];
+
+/* mine.png */
+extern const unsigned char data_mine_png[865];
+
+/* mine_flagged.png */
+extern const unsigned char data_mine_flagged_png[972];
+
+/* flag.png */
+extern const unsigned char data_flag_png[767];
+
+/* numbers.png */
+extern const unsigned char data_numbers_png[1675];
+
+/* game_over.png */
+extern const unsigned char data_game_over_png[1342];
+
+/* victory.png */
+extern const unsigned char data_victory_png[1321];
+
+/* difficulties.png */
+extern const unsigned char data_difficulties_png[3734];
+
+
+#endif /* __DATA_GEN_H__ */
\ No newline at end of file
@@ -0,0 +1,607 @@
+#include "endless.h"
+#include "rng.h"
+
+#include <string.h>
+
+#define ENDLESS_BUCKETS (ENDLESS_MAX_CHUNKS * 2)
+#define ENDLESS_ARCHIVED_BUCKETS (ENDLESS_MAX_ARCHIVED / 2)
+
+// Archived rows that are all zeros or all ones are stored as just
+// a 2 bit tag, the other rows as a tag followed by the row itself
+#define ENDLESS_ROW_ZEROS 0
+#define ENDLESS_ROW_ONES 1
+#define ENDLESS_ROW_LITERAL 2
+// Longest packed open and flag rows: the tags and every row
+#define ENDLESS_PACKED_MAX (2 * (sizeof(u64) + ENDLESS_CHUNK_SIZE * sizeof(u32)))
+
+static EndlessLRU lru_init(usize len)
+{
+    EndlessLRU self = {
+        .head = ENDLESS_NONE,
+        .tail = ENDLESS_NONE,
+    };
+    if (!(self.links = calloc(len, sizeof(EndlessLink)))) {
+        panic("Out of memory!");
+    }
+    return self;
+}
+
+static void lru_unlink(EndlessLRU* self, usize i)
+{
+    EndlessLink* link = &self->links[i];
+    if (link->prev != ENDLESS_NONE) {
+        self->links[link->prev].next = link->next;
+    } else {
+        self->head = link->next;
+    }
+    if (link->next != ENDLESS_NONE) {
+        self->links[link->next].prev = link->prev;
+    } else {
+        self->tail = link->prev;
+    }
+}
+
+static void lru_push_front(EndlessLRU* self, usize i)
+{
+    self->links[i].prev = ENDLESS_NONE;
+    self->links[i].next = self->head;
+    if (self->head != ENDLESS_NONE) {
+        self->links[self->head].prev = i;
+    } else {
+        self->tail = i;
+    }
+    self->head = i;
+}
+
+static void lru_touch(EndlessLRU* self, usize i)
+{
+    if (self->head != i) {
+        lru_unlink(self, i);
+        lru_push_front(self, i);
+    }
+}
+
+static u64 endless_hash(i64 cx, i64 cy)
+{
+    u64 z = (u64)cx * (u64)0x9E3779B97F4A7C15 ^ (u64)cy * (u64)0xC2B2AE3D27D4EB4F;
+    z = (z ^ (z >> 30)) * (u64)0xBF58476D1CE4E5B9;
+    z = (z ^ (z >> 27)) * (u64)0x94D049BB133111EB;
+    return z ^ (z >> 31);
+}
+
+static void endless_generate_mines(u64 seed, i64 cx, i64 cy, u32 mine[ENDLESS_CHUNK_SIZE])
+{
+    RNG_XoShiRo256ss rng_xoshiro = rng_xoshiro256ss(seed ^ endless_hash(cx, cy));
+    RNG* rng = (RNG*)&rng_xoshiro;
+
+    u16 indices[ENDLESS_CHUNK_TILES];
+    for (usize i = 0; i < arrlen(indices); i++) {
+        indices[i] = i;
+    }
+    memset(mine, 0, ENDLESS_CHUNK_SIZE * sizeof(u32));
+
+    // Partial Fisher-Yates shuffle, only the first
+    // ENDLESS_MINES_PER_CHUNK indices are needed
+    for (usize i = 0; i < ENDLESS_MINES_PER_CHUNK; i++) {
+        usize j = i + rng_u64_cap(rng, arrlen(indices) - i);
+        swap(u16, indices[i], indices[j]);
+        mine[indices[i] >> ENDLESS_CHUNK_SHIFT] |= (u32)1 << (indices[i] & (ENDLESS_CHUNK_SIZE - 1));
+    }
+
+    // Keep the 3x3 area around the origin free, that's where the player starts
+    for (i64 y = -1; y <= 1; y++) {
+        for (i64 x = -1; x <= 1; x++) {
+            if (x >> ENDLESS_CHUNK_SHIFT == cx && y >> ENDLESS_CHUNK_SHIFT == cy) {
+                mine[y & (ENDLESS_CHUNK_SIZE - 1)] &= ~((u32)1 << (x & (ENDLESS_CHUNK_SIZE - 1)));
+            }
+        }
+    }
+}
+
+EndlessBoard endless_init(u64 seed)
+{
+    EndlessBoard self = {
+        .seed = seed,
+        .chunks_lru = lru_init(ENDLESS_MAX_CHUNKS),
+        .hot_lru = lru_init(ENDLESS_HOT_CHUNKS),
+        .archived_cap = 64,
+        .archived_free = ENDLESS_NONE,
+        .archived_lru = lru_init(64),
+    };
+
+    if (!(self.chunks = calloc(ENDLESS_MAX_CHUNKS, sizeof(EndlessChunk)))
+        || !(self.buckets = malloc(ENDLESS_BUCKETS * sizeof(usize)))
+        || !(self.hot = calloc(ENDLESS_HOT_CHUNKS, sizeof(EndlessHotChunk)))
+        || !(self.archived = malloc(self.archived_cap * sizeof(EndlessArchived)))
+        || !(self.archived_buckets = malloc(ENDLESS_ARCHIVED_BUCKETS * sizeof(usize)))) {
+        panic("Out of memory!");
+    }
+    for (usize i = 0; i < ENDLESS_BUCKETS; i++) {
+        self.buckets[i] = ENDLESS_NONE;
+    }
+    for (usize i = 0; i < ENDLESS_ARCHIVED_BUCKETS; i++) {
+        self.archived_buckets[i] = ENDLESS_NONE;
+    }
+    for (usize i = 0; i < ENDLESS_MAX_CHUNKS; i++) {
+        self.chunks[i].next = i + 1 < ENDLESS_MAX_CHUNKS ? i + 1 : ENDLESS_NONE;
+    }
+    self.chunks_free = 0;
+    for (usize i = 0; i < ENDLESS_HOT_CHUNKS; i++) {
+        self.hot[i].chunk = i + 1 < ENDLESS_HOT_CHUNKS ? i + 1 : ENDLESS_NONE;
+    }
+    self.hot_free = 0;
+
+    return self;
+}
+
+void endless_deinit(const EndlessBoard* self)
+{
+    free(self->chunks);
+    free(self->buckets);
+    free(self->hot);
+    free(self->chunks_lru.links);
+    free(self->hot_lru.links);
+    free(self->archived_lru.links);
+    // Free slots have their data set to NULL
+    for (usize i = 0; i < self->archived_len; i++) {
+        free(self->archived[i].data);
+    }
+    free(self->archived);
+    free(self->archived_buckets);
+}
+
+static bool endless_chunk_has_state(const EndlessChunk* chunk)
+{
+    for (usize i = 0; i < ENDLESS_CHUNK_SIZE; i++) {
+        if (chunk->open[i] || chunk->flag[i]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static usize endless_find(const EndlessBoard* self, i64 cx, i64 cy)
+{
+    usize i = self->buckets[endless_hash(cx, cy) % ENDLESS_BUCKETS];
+    while (i != ENDLESS_NONE && (self->chunks[i].cx != cx || self->chunks[i].cy != cy)) {
+        i = self->chunks[i].next;
+    }
+    return i;
+}
+
+static void endless_release_hot(EndlessBoard* self, usize chunk_index)
+{
+    usize hot_index = self->chunks[chunk_index].hot;
+    if (hot_index == ENDLESS_NONE) {
+        return;
+    }
+    lru_unlink(&self->hot_lru, hot_index);
+    self->hot[hot_index].chunk = self->hot_free;
+    self->hot_free = hot_index;
+    self->chunks[chunk_index].hot = ENDLESS_NONE;
+}
+
+static void endless_forget(EndlessBoard* self, usize chunk_index)
+{
+    EndlessChunk* chunk = &self->chunks[chunk_index];
+    endless_release_hot(self, chunk_index);
+
+    usize* link = &self->buckets[endless_hash(chunk->cx, chunk->cy) % ENDLESS_BUCKETS];
+    while (*link != chunk_index) {
+        link = &self->chunks[*link].next;
+    }
+    *link = chunk->next;
+
+    lru_unlink(&self->chunks_lru, chunk_index);
+    chunk->next = self->chunks_free;
+    self->chunks_free = chunk_index;
+}
+
+// Write the tags of all rows, followed by the literal rows,
+// returns the number of bytes written
+static usize endless_pack_rows(const u32 rows[ENDLESS_CHUNK_SIZE], u8* out)
+{
+    // One 2 bit tag per row fills exactly a u64
+    u64 tags = 0;
+    usize len = sizeof(tags);
+    for (usize y = 0; y < ENDLESS_CHUNK_SIZE; y++) {
+        u64 tag = rows[y] == 0 ? ENDLESS_ROW_ZEROS : rows[y] == ~(u32)0 ? ENDLESS_ROW_ONES : ENDLESS_ROW_LITERAL;
+        tags |= tag << (y * 2);
+        if (tag == ENDLESS_ROW_LITERAL) {
+            memcpy(out + len, &rows[y], sizeof(u32));
+            len += sizeof(u32);
+        }
+    }
+    memcpy(out, &tags, sizeof(tags));
+    return len;
+}
+
+// Inverse of endless_pack_rows, returns the number of bytes read
+static usize endless_unpack_rows(const u8* in, u32 rows[ENDLESS_CHUNK_SIZE])
+{
+    u64 tags;
+    memcpy(&tags, in, sizeof(tags));
+    usize len = sizeof(tags);
+    for (usize y = 0; y < ENDLESS_CHUNK_SIZE; y++) {
+        switch ((tags >> (y * 2)) & 3) {
+        case ENDLESS_ROW_ZEROS:
+            rows[y] = 0;
+            break;
+        case ENDLESS_ROW_ONES:
+            rows[y] = ~(u32)0;
+            break;
+        default:
+            memcpy(&rows[y], in + len, sizeof(u32));
+            len += sizeof(u32);
+            break;
+        }
+    }
+    return len;
+}
+
+static usize endless_find_archived(const EndlessBoard* self, i64 cx, i64 cy)
+{
+    usize i = self->archived_buckets[endless_hash(cx, cy) % ENDLESS_ARCHIVED_BUCKETS];
+    while (i != ENDLESS_NONE && (self->archived[i].cx != cx || self->archived[i].cy != cy)) {
+        i = self->archived[i].next;
+    }
+    return i;
+}
+
+// Find the link in an archive bucket pointing to an archived chunk
+static usize* endless_archived_link(EndlessBoard* self, usize archived_index)
+{
+    const EndlessArchived* archived = &self->archived[archived_index];
+    usize* link = &self->archived_buckets[endless_hash(archived->cx, archived->cy) % ENDLESS_ARCHIVED_BUCKETS];
+    while (*link != archived_index) {
+        link = &self->archived[*link].next;
+    }
+    return link;
+}
+
+// Unlink an archived chunk and free its rows, leaving the slot unused
+static void endless_archived_remove(EndlessBoard* self, usize archived_index)
+{
+    EndlessArchived* archived = &self->archived[archived_index];
+    *endless_archived_link(self, archived_index) = archived->next;
+    lru_unlink(&self->archived_lru, archived_index);
+    free(archived->data);
+    archived->data = NULL;
+}
+
+// Take a slot for a newly archived chunk, pushing out the
+// least recently archived one if the archive is full
+static usize endless_archived_slot(EndlessBoard* self)
+{
+    usize i = self->archived_free;
+    if (i != ENDLESS_NONE) {
+        self->archived_free = self->archived[i].next;
+        return i;
+    }
+    if (self->archived_len == ENDLESS_MAX_ARCHIVED) {
+        // The player state of this chunk is lost for good
+        i = self->archived_lru.tail;
+        endless_archived_remove(self, i);
+        return i;
+    }
+    if (self->archived_len == self->archived_cap) {
+        self->archived_cap *= 2;
+        if (!(self->archived = realloc(self->archived, self->archived_cap * sizeof(EndlessArchived)))
+            || !(self->archived_lru.links = realloc(self->archived_lru.links, self->archived_cap * sizeof(EndlessLink)))) {
+            panic("Out of memory!");
+        }
+    }
+    return self->archived_len++;
+}
+
+// Compress the player state of a chunk into the archive
+static void endless_archive(EndlessBoard* self, usize chunk_index)
+{
+    const EndlessChunk* chunk = &self->chunks[chunk_index];
+    u8 packed[ENDLESS_PACKED_MAX];
+    usize len = endless_pack_rows(chunk->open, packed);
+    len += endless_pack_rows(chunk->flag, packed + len);
+
+    usize i = endless_archived_slot(self);
+    EndlessArchived* archived = &self->archived[i];
+    if (!(archived->data = malloc(len))) {
+        panic("Out of memory!");
+    }
+    memcpy(archived->data, packed, len);
+    archived->cx = chunk->cx;
+    archived->cy = chunk->cy;
+    usize* bucket = &self->archived_buckets[endless_hash(chunk->cx, chunk->cy) % ENDLESS_ARCHIVED_BUCKETS];
+    archived->next = *bucket;
+    *bucket = i;
+    lru_push_front(&self->archived_lru, i);
+}
+
+// Take a free slot for a new empty (all closed) chunk, pushing
+// out the least recently used chunk if the table is full
+static usize endless_insert(EndlessBoard* self, i64 cx, i64 cy)
+{
+    if (self->chunks_free == ENDLESS_NONE) {
+        usize evicted = self->chunks_lru.tail;
+        if (endless_chunk_has_state(&self->chunks[evicted])) {
+            endless_archive(self, evicted);
+        }
+        endless_forget(self, evicted);
+    }
+    usize i = self->chunks_free;
+    EndlessChunk* chunk = &self->chunks[i];
+    self->chunks_free = chunk->next;
+
+    memset(chunk, 0, sizeof(EndlessChunk));
+    chunk->cx = cx;
+    chunk->cy = cy;
+    chunk->hot = ENDLESS_NONE;
+    usize* bucket = &self->buckets[endless_hash(cx, cy) % ENDLESS_BUCKETS];
+    chunk->next = *bucket;
+    *bucket = i;
+    lru_push_front(&self->chunks_lru, i);
+
+    return i;
+}
+
+// Move a chunk from the archive back into the table,
+// returns ENDLESS_NONE if it isn't archived
+static usize endless_restore(EndlessBoard* self, i64 cx, i64 cy)
+{
+    usize archived_index = endless_find_archived(self, cx, cy);
+    if (archived_index == ENDLESS_NONE) {
+        return ENDLESS_NONE;
+    }
+
+    // Unpack and free the entry first, inserting can archive
+    // another chunk, which may need the slot or move the archive
+    u32 open[ENDLESS_CHUNK_SIZE];
+    u32 flag[ENDLESS_CHUNK_SIZE];
+    const u8* data = self->archived[archived_index].data;
+    endless_unpack_rows(data + endless_unpack_rows(data, open), flag);
+    endless_archived_remove(self, archived_index);
+    self->archived[archived_index].next = self->archived_free;
+    self->archived_free = archived_index;
+
+    usize i = endless_insert(self, cx, cy);
+    memcpy(self->chunks[i].open, open, sizeof(open));
+    memcpy(self->chunks[i].flag, flag, sizeof(flag));
+    return i;
+}
+
+// Look up a chunk, restoring it from the archive if
+// it was pushed out, or ENDLESS_NONE if it doesn't exist
+static usize endless_load(EndlessBoard* self, i64 cx, i64 cy)
+{
+    usize i = endless_find(self, cx, cy);
+    if (i != ENDLESS_NONE) {
+        lru_touch(&self->chunks_lru, i);
+        return i;
+    }
+    return endless_restore(self, cx, cy);
+}
+
+// Look up a chunk, creating an empty (all closed) one if it doesn't exist
+static usize endless_chunk(EndlessBoard* self, i64 cx, i64 cy)
+{
+    usize i = endless_load(self, cx, cy);
+    return i != ENDLESS_NONE ? i : endless_insert(self, cx, cy);
+}
+
+// Generate the mines and nearby mine counts of a chunk
+static EndlessHotChunk* endless_make_hot(EndlessBoard* self, usize chunk_index)
+{
+    EndlessChunk* chunk = &self->chunks[chunk_index];
+    if (chunk->hot != ENDLESS_NONE) {
+        lru_touch(&self->hot_lru, chunk->hot);
+        return &self->hot[chunk->hot];
+    }
+
+    if (self->hot_free == ENDLESS_NONE) {
+        usize evicted = self->hot[self->hot_lru.tail].chunk;
+        endless_release_hot(self, evicted);
+        if (!endless_chunk_has_state(&self->chunks[evicted])) {
+            endless_forget(self, evicted);
+        }
+    }
+    usize hot_index = self->hot_free;
+    EndlessHotChunk* hot = &self->hot[hot_index];
+    self->hot_free = hot->chunk;
+    hot->chunk = chunk_index;
+    chunk->hot = hot_index;
+    lru_push_front(&self->hot_lru, hot_index);
+
+    // Mines of this chunk and its 8 neighbours, one
+    // row of 32 + 2 bits per u64, shifted by 1 column
+    u64 rows[ENDLESS_CHUNK_SIZE + 2] = { 0 };
+    for (i64 dy = -1; dy <= 1; dy++) {
+        for (i64 dx = -1; dx <= 1; dx++) {
+            u32 mine[ENDLESS_CHUNK_SIZE];
+            endless_generate_mines(self->seed, chunk->cx + dx, chunk->cy + dy, mine);
+            if (dx == 0 && dy == 0) {
+                memcpy(hot->mine, mine, sizeof(mine));
+            }
+            for (usize y = 0; y < ENDLESS_CHUNK_SIZE; y++) {
+                isize row = (isize)y + 1 + dy * ENDLESS_CHUNK_SIZE;
+                if (row < 0 || row >= (isize)arrlen(rows)) {
+                    continue;
+                }
+                if (dx == -1) {
+                    rows[row] |= (u64)(mine[y] >> (ENDLESS_CHUNK_SIZE - 1));
+                } else if (dx == 0) {
+                    rows[row] |= (u64)mine[y] << 1;
+                } else {
+                    rows[row] |= (u64)(mine[y] & 1) << (ENDLESS_CHUNK_SIZE + 1);
+                }
+            }
+        }
+    }
+
+    for (usize y = 0; y < ENDLESS_CHUNK_SIZE; y++) {
+        for (usize x = 0; x < ENDLESS_CHUNK_SIZE; x++) {
+            u8 n = 0;
+            for (usize r = y; r < y + 3; r++) {
+                n += __builtin_popcountll((rows[r] >> x) & 7);
+            }
+            n -= (hot->mine[y] >> x) & 1;
+            hot->nearby_mines[y * ENDLESS_CHUNK_SIZE + x] = n;
+        }
+    }
+
+    return hot;
+}
+
+bool endless_tile(EndlessBoard* self, i64 x, i64 y, Tile* tile)
+{
+    usize lx = x & (ENDLESS_CHUNK_SIZE - 1);
+    usize ly = y & (ENDLESS_CHUNK_SIZE - 1);
+
+    *tile = (Tile) { 0 };
+    usize i = endless_load(self, x >> ENDLESS_CHUNK_SHIFT, y >> ENDLESS_CHUNK_SHIFT);
+    if (i == ENDLESS_NONE) {
+        return false;
+    }
+    EndlessChunk* chunk = &self->chunks[i];
+    tile->open = (chunk->open[ly] >> lx) & 1;
+    tile->flag = (chunk->flag[ly] >> lx) & 1;
+    if (chunk->hot == ENDLESS_NONE) {
+        return false;
+    }
+    EndlessHotChunk* hot = &self->hot[chunk->hot];
+    lru_touch(&self->hot_lru, chunk->hot);
+    tile->mine = (hot->mine[ly] >> lx) & 1;
+    tile->nearby_mines = hot->nearby_mines[ly * ENDLESS_CHUNK_SIZE + lx];
+    return true;
+}
+
+void endless_flag(EndlessBoard* self, i64 x, i64 y)
+{
+    usize lx = x & (ENDLESS_CHUNK_SIZE - 1);
+    usize ly = y & (ENDLESS_CHUNK_SIZE - 1);
+
+    EndlessChunk* chunk = &self->chunks[endless_chunk(self, x >> ENDLESS_CHUNK_SHIFT, y >> ENDLESS_CHUNK_SHIFT)];
+    if (!((chunk->open[ly] >> lx) & 1)) {
+        chunk->flag[ly] ^= (u32)1 << lx;
+    }
+}
+
+static const i64 endless_offsets[8][2] = {
+    { -1, -1 },
+    { 0, -1 },
+    { 1, -1 },
+    { -1, 0 },
+    { 1, 0 },
+    { -1, 1 },
+    { 0, 1 },
+    { 1, 1 },
+};
+
+// Open a single tile, returning its nearby mine count, or -1 if it
+// was already open. Counts the chunk in generated if it made it hot.
+static i32 endless_open(EndlessBoard* self, i64 x, i64 y, usize* generated)
+{
+    usize lx = x & (ENDLESS_CHUNK_SIZE - 1);
+    usize ly = y & (ENDLESS_CHUNK_SIZE - 1);
+
+    usize chunk_index = endless_chunk(self, x >> ENDLESS_CHUNK_SHIFT, y >> ENDLESS_CHUNK_SHIFT);
+    EndlessChunk* chunk = &self->chunks[chunk_index];
+    if ((chunk->open[ly] >> lx) & 1) {
+        return -1;
+    }
+    // Set the open bit before generating, so the chunk has
+    // state and can't be forgotten if hot chunks get evicted
+    chunk->open[ly] |= (u32)1 << lx;
+    *generated += chunk->hot == ENDLESS_NONE;
+    EndlessHotChunk* hot = endless_make_hot(self, chunk_index);
+    return hot->nearby_mines[ly * ENDLESS_CHUNK_SIZE + lx];
+}
+
+void endless_prefetch(EndlessBoard* self, i64 x0, i64 y0, i64 x1, i64 y1, usize budget)
+{
+    for (i64 cy = y0 >> ENDLESS_CHUNK_SHIFT; cy <= y1 >> ENDLESS_CHUNK_SHIFT && budget > 0; cy++) {
+        for (i64 cx = x0 >> ENDLESS_CHUNK_SHIFT; cx <= x1 >> ENDLESS_CHUNK_SHIFT && budget > 0; cx++) {
+            usize i = endless_load(self, cx, cy);
+            if (i != ENDLESS_NONE && self->chunks[i].hot == ENDLESS_NONE) {
+                endless_make_hot(self, i);
+                budget--;
+            }
+        }
+    }
+}
+
+EndlessExplorer endless_explorer_init(void)
+{
+    EndlessExplorer self = {
+        .queue_cap = 64,
+    };
+
+    if (!(self.queue = malloc(self.queue_cap * sizeof(*self.queue)))) {
+        panic("Out of memory!");
+    }
+
+    return self;
+}
+
+void endless_explorer_deinit(const EndlessExplorer* self)
+{
+    free(self->queue);
+}
+
+static void endless_explorer_push(EndlessExplorer* self, i64 x, i64 y)
+{
+    if (self->queue_len == self->queue_cap) {
+        usize old_cap = self->queue_cap;
+        self->queue_cap *= 2;
+        if (!(self->queue = realloc(self->queue, self->queue_cap * sizeof(*self->queue)))) {
+            panic("Out of memory!");
+        }
+        // Unwrap the part of the ring buffer that wrapped around
+        usize wrapped = self->queue_head + self->queue_len - old_cap;
+        if (self->queue_head + self->queue_len > old_cap) {
+            memcpy(self->queue + old_cap, self->queue, wrapped * sizeof(*self->queue));
+        }
+    }
+    usize tail = (self->queue_head + self->queue_len) % self->queue_cap;
+    self->queue[tail][0] = x;
+    self->queue[tail][1] = y;
+    self->queue_len++;
+}
+
+bool endless_explorer_start(EndlessExplorer* self, EndlessBoard* board, i64 x, i64 y)
+{
+    usize lx = x & (ENDLESS_CHUNK_SIZE - 1);
+    usize ly = y & (ENDLESS_CHUNK_SIZE - 1);
+
+    usize chunk_index = endless_chunk(board, x >> ENDLESS_CHUNK_SHIFT, y >> ENDLESS_CHUNK_SHIFT);
+    EndlessHotChunk* hot = endless_make_hot(board, chunk_index);
+    if ((hot->mine[ly] >> lx) & 1) {
+        return false;
+    }
+
+    usize generated = 0;
+    if (endless_open(board, x, y, &generated) == 0) {
+        endless_explorer_push(self, x, y);
+    }
+
+    return true;
+}
+
+bool endless_explorer_step(EndlessExplorer* self, EndlessBoard* board, usize budget, usize chunks)
+{
+    usize generated = 0;
+    for (; budget > 0 && self->queue_len > 0 && generated < chunks; budget--) {
+        i64 x = self->queue[self->queue_head][0];
+        i64 y = self->queue[self->queue_head][1];
+        self->queue_head = (self->queue_head + 1) % self->queue_cap;
+        self->queue_len--;
+
+        for (usize i = 0; i < arrlen(endless_offsets); i++) {
+            i64 nx = x + endless_offsets[i][0];
+            i64 ny = y + endless_offsets[i][1];
+            if (endless_open(board, nx, ny, &generated) == 0) {
+                endless_explorer_push(self, nx, ny);
+            }
+        }
+    }
+
+    return self->queue_len > 0;
+}
@@ -0,0 +1,133 @@
+#ifndef __ENDLESS_H__
+#define __ENDLESS_H__
+
+#include "main.h"
+#include "board.h"
+
+// Endless mode: an unbounded board made of square chunks. Mines are
+// derived deterministically from (seed, chunk_x, chunk_y), so only
+// the player's open and flag bits have to be remembered.
+//
+// Chunks exist in two forms:
+// - cold: only the open and flag bitmasks (256 bytes)
+// - hot: additionally the generated mines and nearby mine counts
+// Hot chunks live in a small LRU cache and are compressed back to
+// their cold form on eviction. Cold chunks that hold no player state
+// are dropped entirely. Once the table of cold chunks is full, the
+// least recently used one is pushed out: dropped if it has no player
+// state, otherwise compressed into an archive it is restored from
+// when it is needed again. The archive grows with the area the player
+// has opened or flagged, up to ENDLESS_MAX_ARCHIVED chunks. Past that
+// the least recently archived chunk is dropped and its tiles turn back
+// into closed ones, so memory stays bounded however far the player goes.
+
+// Rows are stored as u32 bitmasks, so a chunk is 32x32 tiles
+#define ENDLESS_CHUNK_SHIFT 5
+#define ENDLESS_CHUNK_SIZE (1 << ENDLESS_CHUNK_SHIFT)
+#define ENDLESS_CHUNK_TILES (ENDLESS_CHUNK_SIZE * ENDLESS_CHUNK_SIZE)
+// Roughly 16% mine density, which keeps empty regions finite
+#define ENDLESS_MINES_PER_CHUNK 164
+// Number of chunks with generated mines and counts
+#define ENDLESS_HOT_CHUNKS 256
+// Number of chunks whose open and flag state is remembered
+#define ENDLESS_MAX_CHUNKS 16384
+// Number of archived chunks, a power of two. At most 264 bytes of rows
+// and 56 of bookkeeping each, so about 80 MiB in the worst case and far
+// less for the mostly uniform rows of explored areas.
+#define ENDLESS_MAX_ARCHIVED (1 << 18)
+
+#define ENDLESS_NONE (~(usize)0)
+
+typedef struct {
+    usize prev;
+    usize next;
+} EndlessLink;
+
+typedef struct {
+    EndlessLink* links;
+    usize head; // most recently used
+    usize tail; // least recently used
+} EndlessLRU;
+
+typedef struct {
+    u32 mine[ENDLESS_CHUNK_SIZE];
+    u8 nearby_mines[ENDLESS_CHUNK_TILES];
+    usize chunk;
+} EndlessHotChunk;
+
+typedef struct {
+    i64 cx;
+    i64 cy;
+    u32 open[ENDLESS_CHUNK_SIZE];
+    u32 flag[ENDLESS_CHUNK_SIZE];
+    usize hot; // index into hot chunks or ENDLESS_NONE
+    usize next; // next chunk in the same hash bucket or free list
+} EndlessChunk;
+
+// A chunk pushed out of the table, with its open and flag rows
+// compressed by endless_pack_rows
+typedef struct {
+    i64 cx;
+    i64 cy;
+    u8* data;
+    usize next; // next archived chunk in the same hash bucket or free list
+} EndlessArchived;
+
+// Resumable flood fill, like BoardExplorer. Opening tiles near the
+// edge of a chunk generates the chunks next to it, so every step is
+// bounded both in tiles and in generated chunks.
+typedef struct {
+    i64 (*queue)[2]; // ring buffer of open tiles without nearby mines
+    usize queue_head;
+    usize queue_len;
+    usize queue_cap;
+} EndlessExplorer;
+
+typedef struct {
+    u64 seed;
+    EndlessChunk* chunks;
+    usize* buckets;
+    usize chunks_free;
+    EndlessLRU chunks_lru;
+    EndlessHotChunk* hot;
+    usize hot_free;
+    EndlessLRU hot_lru;
+    EndlessArchived* archived;
+    usize archived_len; // slots handed out so far, live or free
+    usize archived_cap;
+    usize archived_free;
+    EndlessLRU archived_lru;
+    usize* archived_buckets;
+} EndlessBoard;
+
+EndlessBoard endless_init(u64 seed);
+void endless_deinit(const EndlessBoard* self);
+// Get the tile at x and y. Mines and nearby mine counts are only
+// filled in if the tile's chunk is hot, in which case true is returned.
+// This never generates anything (at most it restores an archived
+// chunk), so it is safe to call while drawing.
+bool endless_tile(EndlessBoard* self, i64 x, i64 y, Tile* tile);
+// Toggle the flag on a closed tile
+void endless_flag(EndlessBoard* self, i64 x, i64 y);
+// Generate at most budget chunks within the given tile area which
+// have open tiles but aren't hot yet, so their numbers can be drawn
+void endless_prefetch(EndlessBoard* self, i64 x0, i64 y0, i64 x1, i64 y1, usize budget);
+
+EndlessExplorer endless_explorer_init(void);
+void endless_explorer_deinit(const EndlessExplorer* self);
+// Open the tile at x and y and queue it, if it has no nearby mines.
+// Returns false if the tile was a mine. Can be called while a previous
+// reveal is still in progress.
+bool endless_explorer_start(EndlessExplorer* self, EndlessBoard* board, i64 x, i64 y);
+// Continue the flood fill, processing at most budget queued tiles and
+// stopping once chunks chunks have been generated. A single tile can
+// generate up to 4 chunks, so this may overshoot chunks by as much.
+// Returns true if there is work left.
+bool endless_explorer_step(EndlessExplorer* self, EndlessBoard* board, usize budget, usize chunks);
+
+static inline bool endless_explorer_busy(const EndlessExplorer* self)
+{
+    return self->queue_len > 0;
+}
+
+#endif // __ENDLESS_H__
@@ -0,0 +1,357 @@
+#include "game.h"
+
+#include <SDL2/SDL_timer.h>
+
+#include <string.h>
+
+// A reveal is spread over at least REVEAL_FRAMES ticks, unless it
+// opens fewer than REVEAL_MIN_TILES_PER_FRAME tiles, and never takes
+// more than REVEAL_FRAME_US microseconds of a tick
+#define REVEAL_FRAMES 16
+#define REVEAL_MIN_TILES_PER_FRAME 64
+#define REVEAL_FRAME_US 4000
+// Number of tiles revealed between checking the time
+#define REVEAL_BATCH 1024
+
+static const GameRect rect_empty = { 0, 0, 0, 0 };
+
+// Changed areas can outlive a smaller board after a difficulty change
+static GameRect rect_clamp(GameRect self, usize w, usize h)
+{
+    self.x1 = min(self.x1, w);
+    self.y1 = min(self.y1, h);
+    return self;
+}
+
+// Mark an area of the board as changed for every snapshot
+static void game_mark(Game* self, GameRect rect)
+{
+    game_rect_union(&self->unseen, &rect);
+    game_rect_union(&self->published, &rect);
+    for (usize i = 0; i < GAME_SNAPSHOTS_LEN; i++) {
+        game_rect_union(&self->snapshots[i].pending, &rect);
+    }
+}
+
+static void game_mark_tile(Game* self, usize index)
+{
+    usize x = board_x(&self->board, index), y = board_y(&self->board, index);
+    game_mark(self, (GameRect) { x, y, x + 1, y + 1 });
+}
+
+static void game_mark_all(Game* self)
+{
+    game_mark(self, (GameRect) { 0, 0, self->board.w, self->board.h });
+}
+
+static void game_set_difficulty(Game* self, Difficulty difficulty)
+{
+    board_deinit(&self->board);
+    switch (difficulty) {
+    case DIFFICULTY_EASY:
+        self->board = board_init_ex(9, 9, self->topology);
+        self->mines = 10;
+        break;
+    case DIFFICULTY_MEDIUM:
+        self->board = board_init_ex(16, 16, self->topology);
+        self->mines = 40;
+        break;
+    case DIFFICULTY_HARD:
+        self->board = board_init_ex(20, 20, self->topology);
+        self->mines = 80;
+        break;
+    default:
+        unreachable();
+    }
+    self->difficulty = difficulty;
+    game_mark_all(self);
+}
+
+Game game_init(usize width, usize height, usize mines, BoardTopology topology, u64 seed)
+{
+    Game self = {
+        .explorer = board_explorer_init(),
+        .topology = topology,
+        .rng = rng_xoshiro256ss(seed),
+        .difficulty = DIFFICULTY_EASY,
+        .custom = width > 0,
+        .back = 0,
+        .middle = 1,
+        .front = 2,
+    };
+    if (self.custom) {
+        self.board = board_init_ex(width, height, topology);
+        self.mines = mines;
+        game_mark_all(&self);
+    } else {
+        game_set_difficulty(&self, DIFFICULTY_EASY);
+    }
+    if (!(self.wake = SDL_CreateSemaphore(0))) {
+        panic("failed to create semaphore: %s", SDL_GetError());
+    }
+    if (!(self.published_lock = SDL_CreateMutex()) || !(self.published_cond = SDL_CreateCond())) {
+        panic("failed to create condition variable: %s", SDL_GetError());
+    }
+
+    return self;
+}
+
+static void game_publish(Game* self)
+{
+    GameSnapshot* snapshot = &self->snapshots[self->back];
+    if (snapshot->board.w != self->board.w || snapshot->board.h != self->board.h) {
+        board_deinit(&snapshot->board);
+        snapshot->board = board_init(self->board.w, self->board.h);
+        snapshot->pending = (GameRect) { 0, 0, self->board.w, self->board.h };
+    }
+    const GameRect pending = rect_clamp(snapshot->pending, self->board.w, self->board.h);
+    if (pending.x0 < pending.x1) {
+        usize row_len = (pending.x1 - pending.x0) * sizeof(Tile);
+        for (usize y = pending.y0; y < pending.y1; y++) {
+            memcpy(&snapshot->board.tiles[board_index(&snapshot->board, pending.x0, y)],
+                &self->board.tiles[board_index(&self->board, pending.x0, y)],
+                row_len);
+        }
+    }
+    snapshot->pending = rect_empty;
+    snapshot->dirty = rect_clamp(self->unseen, self->board.w, self->board.h);
+    snapshot->difficulty = self->difficulty;
+    snapshot->custom = self->custom;
+    snapshot->generated = self->generated;
+    snapshot->game_over = self->game_over;
+    snapshot->victory = self->victory;
+    snapshot->processed = self->processed;
+
+    usize previous = __atomic_exchange_n(&self->middle, self->back | GAME_SNAPSHOT_FRESH, __ATOMIC_ACQ_REL);
+    self->back = previous & ~GAME_SNAPSHOT_FRESH;
+    // If the render thread took the previous snapshot, its copy is now
+    // only missing what changed since then. Otherwise the previous
+    // snapshot was dropped and the render thread is further behind.
+    if (!(previous & GAME_SNAPSHOT_FRESH)) {
+        self->unseen = self->published;
+    }
+    self->published = rect_empty;
+
+    SDL_LockMutex(self->published_lock);
+    self->published_processed = self->processed;
+    SDL_CondBroadcast(self->published_cond);
+    SDL_UnlockMutex(self->published_lock);
+}
+
+static bool game_pop(Game* self, GameCommand* command)
+{
+    usize head = self->commands_head;
+    if (head == __atomic_load_n(&self->commands_tail, __ATOMIC_ACQUIRE)) {
+        return false;
+    }
+    *command = self->commands[head % GAME_COMMANDS_CAP];
+    __atomic_store_n(&self->commands_head, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+// Apply tile changes made by undo and redo
+static void game_apply_history(Game* self)
+{
+    for (usize i = 0; i < self->history.changed_len; i++) {
+        game_mark_tile(self, self->history.changed[i].index);
+    }
+    self->history.changed_len = 0;
+}
+
+// Returns false when the logic thread should stop
+static bool game_handle(Game* self, const GameCommand* command)
+{
+    Board* board = &self->board;
+    switch (command->type) {
+    case GAME_COMMAND_OPEN: {
+        if (self->game_over || self->victory || command->x >= board->w || command->y >= board->h) {
+            break;
+        }
+        usize index = board_index(board, command->x, command->y);
+        if (board->tiles[index].flag) {
+            break;
+        }
+        if (!self->generated) {
+            board_generate(board, (RNG*)&self->rng, self->mines, command->x, command->y);
+            self->generated = true;
+            self->history = history_init(board);
+            game_mark_all(self);
+        }
+        if (board->tiles[index].mine) {
+            self->game_over = true;
+        } else {
+            board_explorer_start(&self->explorer, board, command->x, command->y);
+        }
+        break;
+    }
+    case GAME_COMMAND_FLAG: {
+        if (self->game_over || self->victory || command->x >= board->w || command->y >= board->h) {
+            break;
+        }
+        usize index = board_index(board, command->x, command->y);
+        if (!board->tiles[index].open) {
+            board->tiles[index].flag = !board->tiles[index].flag;
+            game_mark_tile(self, index);
+            if (self->generated) {
+                history_touch(&self->history, index);
+            }
+        }
+        break;
+    }
+    case GAME_COMMAND_UNDO:
+        if (!self->generated || board_explorer_busy(&self->explorer)) {
+            break;
+        }
+        // Losing doesn't change any tiles, so
+        // there is nothing to restore
+        if (self->game_over) {
+            self->game_over = false;
+        } else {
+            history_undo(&self->history, board);
+        }
+        game_apply_history(self);
+        break;
+    case GAME_COMMAND_REDO:
+        if (!self->generated || board_explorer_busy(&self->explorer)) {
+            break;
+        }
+        history_redo(&self->history, board);
+        game_apply_history(self);
+        break;
+    case GAME_COMMAND_DIFFICULTY:
+        if (self->generated || self->custom) {
+            break;
+        }
+        game_set_difficulty(self, (self->difficulty + DIFFICULTIES_LEN + command->step) % DIFFICULTIES_LEN);
+        break;
+    case GAME_COMMAND_QUIT:
+        return false;
+    }
+    return true;
+}
+
+static int game_run(void* _self)
+{
+    Game* self = _self;
+    Board* board = &self->board;
+
+    bool run = true;
+    while (run) {
+        // Sleep until a command arrives, or until the next
+        // slice of an ongoing reveal is due
+        if (board_explorer_busy(&self->explorer)) {
+            SDL_SemWaitTimeout(self->wake, GAME_TICK_MS);
+        } else {
+            SDL_SemWait(self->wake);
+        }
+
+        GameCommand command;
+        while (run && game_pop(self, &command)) {
+            run = game_handle(self, &command);
+            self->processed = command.seq;
+        }
+
+        // Reveal a slice of any ongoing flood fill, bounded in both
+        // tiles (so it animates as a wavefront) and time per tick
+        if (board_explorer_busy(&self->explorer)) {
+            usize budget = max(board->w * board->h / REVEAL_FRAMES, REVEAL_MIN_TILES_PER_FRAME);
+            u64 deadline = SDL_GetPerformanceCounter() + SDL_GetPerformanceFrequency() * REVEAL_FRAME_US / 1000000;
+            while (budget > 0 && SDL_GetPerformanceCounter() < deadline) {
+                usize batch = min(budget, REVEAL_BATCH);
+                if (!board_explorer_step(&self->explorer, board, batch)) {
+                    break;
+                }
+                budget -= batch;
+            }
+        }
+        for (usize i = 0; i < self->explorer.opened_len; i++) {
+            game_mark_tile(self, self->explorer.opened[i]);
+            history_touch(&self->history, self->explorer.opened[i]);
+        }
+        self->explorer.opened_len = 0;
+        // Every click (or finished reveal) becomes one undo step
+        if (self->generated && !board_explorer_busy(&self->explorer)) {
+            history_commit(&self->history, board);
+        }
+
+        self->victory = self->generated && !board_explorer_busy(&self->explorer);
+        // Padding tiles are open, so they never prevent a victory
+        for (usize i = 0; self->victory && i < board_tiles_len(board); i++) {
+            if (!board->tiles[i].open && !board->tiles[i].mine) {
+                self->victory = false;
+                break;
+            }
+        }
+
+        game_publish(self);
+    }
+
+    return 0;
+}
+
+void game_start(Game* self)
+{
+    game_publish(self);
+    if (!(self->thread = SDL_CreateThread(game_run, "game", self))) {
+        panic("failed to create game thread: %s", SDL_GetError());
+    }
+}
+
+void game_deinit(Game* self)
+{
+    if (self->thread) {
+        while (!game_send(self, (GameCommand) { .type = GAME_COMMAND_QUIT })) {
+            SDL_Delay(1);
+        }
+        SDL_WaitThread(self->thread, NULL);
+    }
+    SDL_DestroySemaphore(self->wake);
+    SDL_DestroyCond(self->published_cond);
+    SDL_DestroyMutex(self->published_lock);
+    for (usize i = 0; i < GAME_SNAPSHOTS_LEN; i++) {
+        board_deinit(&self->snapshots[i].board);
+    }
+    if (self->generated) {
+        history_deinit(&self->history);
+    }
+    board_explorer_deinit(&self->explorer);
+    board_deinit(&self->board);
+}
+
+usize game_send(Game* self, GameCommand command)
+{
+    usize tail = self->commands_tail;
+    if (tail - __atomic_load_n(&self->commands_head, __ATOMIC_ACQUIRE) >= GAME_COMMANDS_CAP) {
+        return 0;
+    }
+    command.seq = tail + 1;
+    self->commands[tail % GAME_COMMANDS_CAP] = command;
+    __atomic_store_n(&self->commands_tail, tail + 1, __ATOMIC_RELEASE);
+    SDL_SemPost(self->wake);
+    return command.seq;
+}
+
+const GameSnapshot* game_poll(Game* self)
+{
+    if (!(__atomic_load_n(&self->middle, __ATOMIC_RELAXED) & GAME_SNAPSHOT_FRESH)) {
+        return NULL;
+    }
+    self->front = __atomic_exchange_n(&self->middle, self->front, __ATOMIC_ACQ_REL) & ~GAME_SNAPSHOT_FRESH;
+    return &self->snapshots[self->front];
+}
+
+bool game_wait(Game* self, usize seq, u32 timeout_ms)
+{
+    u32 deadline = SDL_GetTicks() + timeout_ms;
+    SDL_LockMutex(self->published_lock);
+    bool done;
+    while (!(done = self->published_processed >= seq)) {
+        i32 remaining = (i32)(deadline - SDL_GetTicks());
+        if (remaining <= 0 || SDL_CondWaitTimeout(self->published_cond, self->published_lock, remaining) == SDL_MUTEX_TIMEDOUT) {
+            done = self->published_processed >= seq;
+            break;
+        }
+    }
+    SDL_UnlockMutex(self->published_lock);
+    return done;
+}
@@ -0,0 +1,149 @@
+#ifndef __GAME_H__
+#define __GAME_H__
+
+#include "main.h"
+#include "board.h"
+#include "history.h"
+#include "rng.h"
+
+#include <SDL2/SDL_mutex.h>
+#include <SDL2/SDL_thread.h>
+
+// Game logic running on its own thread. The render thread sends it
+// commands through a single-producer single-consumer ring buffer, and
+// it publishes the resulting state through three snapshot buffers:
+// one being written by the logic thread, one being read by the render
+// thread, and the most recently published one in between, exchanged
+// with a single atomic index. Neither side ever waits for the other,
+// unless the render thread chooses to wait for the result of a command
+// with game_wait.
+//
+// Snapshots are updated by copying only the rows changed since the
+// buffer was last written, and carry the area changed since the last
+// snapshot the render thread is known to have taken, so it only has
+// to look at that area to update its own copy.
+
+#define GAME_SNAPSHOTS_LEN 3
+// Set in the published index while the render thread hasn't taken it
+#define GAME_SNAPSHOT_FRESH ((usize)1 << (sizeof(usize) * 8 - 1))
+#define GAME_COMMANDS_CAP 256
+// Interval of logic ticks while a reveal is in progress
+#define GAME_TICK_MS 16
+
+typedef enum {
+    DIFFICULTY_EASY,
+    DIFFICULTY_MEDIUM,
+    DIFFICULTY_HARD,
+    DIFFICULTIES_LEN,
+} Difficulty;
+
+typedef enum {
+    GAME_COMMAND_OPEN,
+    GAME_COMMAND_FLAG,
+    GAME_COMMAND_UNDO,
+    GAME_COMMAND_REDO,
+    GAME_COMMAND_DIFFICULTY,
+    GAME_COMMAND_QUIT,
+} GameCommandType;
+
+typedef struct {
+    GameCommandType type;
+    usize x; // tile for open and flag
+    usize y;
+    i32 step; // difficulty change
+    usize seq; // set by game_send, starting at 1
+} GameCommand;
+
+// x1 and y1 are exclusive, empty if x0 >= x1
+typedef struct {
+    usize x0;
+    usize y0;
+    usize x1;
+    usize y1;
+} GameRect;
+
+static inline void game_rect_union(GameRect* self, const GameRect* other)
+{
+    if (other->x0 >= other->x1) {
+        return;
+    }
+    if (self->x0 >= self->x1) {
+        *self = *other;
+        return;
+    }
+    self->x0 = min(self->x0, other->x0);
+    self->y0 = min(self->y0, other->y0);
+    self->x1 = max(self->x1, other->x1);
+    self->y1 = max(self->y1, other->y1);
+}
+
+typedef struct {
+    Board board;
+    // Tiles possibly changed since the previous snapshot taken
+    // by the render thread
+    GameRect dirty;
+    Difficulty difficulty;
+    bool custom;
+    bool generated;
+    bool game_over;
+    bool victory;
+    // Sequence number of the last command whose result is included
+    usize processed;
+    // Tiles changed since this buffer was last written,
+    // only used by the logic thread
+    GameRect pending;
+} GameSnapshot;
+
+typedef struct {
+    // Logic thread
+    Board board;
+    usize mines;
+    BoardTopology topology;
+    BoardExplorer explorer;
+    History history; // created once the board is generated
+    RNG_XoShiRo256ss rng;
+    Difficulty difficulty;
+    bool custom;
+    bool generated;
+    bool game_over;
+    bool victory;
+    GameRect unseen; // changed since the last snapshot known to be taken
+    GameRect published; // changed since the last snapshot
+    usize back;
+    usize processed; // sequence number of the last handled command
+    SDL_Thread* thread;
+    SDL_sem* wake;
+
+    // Shared
+    GameSnapshot snapshots[GAME_SNAPSHOTS_LEN];
+    usize middle; // index of the last published snapshot, see GAME_SNAPSHOT_FRESH
+    GameCommand commands[GAME_COMMANDS_CAP];
+    usize commands_head; // written by the logic thread
+    usize commands_tail; // written by the render thread
+    // Signalled on every publish, for game_wait
+    SDL_mutex* published_lock;
+    SDL_cond* published_cond;
+    usize published_processed; // protected by published_lock
+
+    // Render thread
+    usize front;
+} Game;
+
+// Start with a custom board, or the easy difficulty if width is 0
+Game game_init(usize width, usize height, usize mines, BoardTopology topology, u64 seed);
+// Publish the initial snapshot and start the logic thread
+void game_start(Game* self);
+// Stop the logic thread and free everything
+void game_deinit(Game* self);
+// Queue a command for the logic thread. Returns its sequence number,
+// or 0 if the queue is full.
+usize game_send(Game* self, GameCommand command);
+// Take the last published snapshot if there is a new one, NULL otherwise.
+// The snapshot stays valid until the next call.
+const GameSnapshot* game_poll(Game* self);
+// Wait at most timeout_ms for a snapshot including the result of the
+// command with sequence number seq to be published, so the next
+// game_poll returns it. Returns false on timeout.
+bool game_wait(Game* self, usize seq, u32 timeout_ms);
+
+#endif // __GAME_H__
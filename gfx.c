@@ -0,0 +1,117 @@
+#include "gfx.h"
+#include "data.gen.h"
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_image.h>
+#include <SDL2/SDL_rwops.h>
+
+static SDL_Texture* load_texture(SDL_Renderer* renderer, const u8* mem, usize mem_len)
+{
+    return IMG_LoadTexture_RW(renderer, SDL_RWFromConstMem(mem, mem_len), 1);
+}
+
+static void load_textures(Gfx* self)
+{
+    SDL_Renderer* renderer = self->renderer;
+    self->textures[TEXTURE_TILE_CLOSED] = load_texture(renderer, data_tile_closed_png, arrlen(data_tile_closed_png));
+    self->textures[TEXTURE_TILE_OPEN] = load_texture(renderer, data_tile_open_png, arrlen(data_tile_open_png));
+    self->textures[TEXTURE_MINE] = load_texture(renderer, data_mine_png, arrlen(data_mine_png));
+    self->textures[TEXTURE_MINE_FLAGGED] = load_texture(renderer, data_mine_flagged_png, arrlen(data_mine_flagged_png));
+    self->textures[TEXTURE_FLAG] = load_texture(renderer, data_flag_png, arrlen(data_flag_png));
+    self->textures[TEXTURE_NUMBERS] = load_texture(renderer, data_numbers_png, arrlen(data_numbers_png));
+    self->textures[TEXTURE_GAME_OVER] = load_texture(renderer, data_game_over_png, arrlen(data_game_over_png));
+    self->textures[TEXTURE_VICTORY] = load_texture(renderer, data_victory_png, arrlen(data_victory_png));
+    self->textures[TEXTURE_DIFFICULTIES] = load_texture(renderer, data_difficulties_png, arrlen(data_difficulties_png));
+
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+}
+
+Gfx gfx_init(const char* window_title, bool vsync)
+{
+    if (SDL_Init(SDL_INIT_VIDEO) < 0) {
+        panic("failed to initialize SDL: %s", SDL_GetError());
+    }
+
+    SDL_Rect display_bounds;
+    SDL_GetDisplayUsableBounds(0, &display_bounds);
+
+    SDL_Window* window = SDL_CreateWindow(window_title,
+        SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED,
+        display_bounds.w * 0.8, display_bounds.h * 0.8,
+        SDL_WINDOW_RESIZABLE);
+    if (!window) {
+        panic("failed to initialize window: %s", SDL_GetError());
+    }
+
+    SDL_Renderer* renderer = SDL_CreateRenderer(window,
+        -1,
+        SDL_RENDERER_ACCELERATED | (vsync ? SDL_RENDERER_PRESENTVSYNC : 0));
+
+    Gfx self = {
+        .window = window,
+        .renderer = renderer,
+    };
+    load_textures(&self);
+
+    return self;
+}
+
+Gfx gfx_init_surface(SDL_Surface* surface)
+{
+    SDL_Renderer* renderer = SDL_CreateSoftwareRenderer(surface);
+    if (!renderer) {
+        panic("failed to initialize software renderer: %s", SDL_GetError());
+    }
+
+    Gfx self = {
+        .window = NULL,
+        .renderer = renderer,
+    };
+    load_textures(&self);
+
+    return self;
+}
+
+void gfx_deinit(const Gfx* self)
+{
+    for (usize i = 0; i < arrlen(self->textures); i++) {
+        SDL_DestroyTexture(self->textures[i]);
+    }
+    SDL_DestroyRenderer(self->renderer);
+    if (self->window) {
+        SDL_DestroyWindow(self->window);
+        SDL_Quit();
+    }
+}
+
+void gfx_draw_tile(const Gfx* self, const Tile* tile, const SDL_FRect* dest, bool game_over, bool victory)
+{
+    Texture texture = tile->open ? TEXTURE_TILE_OPEN : TEXTURE_TILE_CLOSED;
+    SDL_RenderCopyF(self->renderer, self->textures[texture],
+        NULL,
+        dest);
+    if ((game_over || tile->open)
+        && !tile->mine
+        && !tile->flag
+        && tile->nearby_mines > 0) {
+        SDL_Rect src = {
+            (tile->nearby_mines - 1) * 16,
+            0,
+            16,
+            16,
+        };
+        SDL_RenderCopyF(self->renderer, self->textures[TEXTURE_NUMBERS],
+            &src,
+            dest);
+    }
+    if ((game_over || victory) && tile->mine) {
+        Texture texture = tile->flag ? TEXTURE_MINE_FLAGGED : TEXTURE_MINE;
+        SDL_RenderCopyF(self->renderer, self->textures[texture],
+            NULL,
+            dest);
+    } else if (!tile->open && tile->flag) {
+        SDL_RenderCopyF(self->renderer, self->textures[TEXTURE_FLAG],
+            NULL,
+            dest);
+    }
+}
@@ -0,0 +1,39 @@
+#ifndef __GFX_H__
+#define __GFX_H__
+
+#include "main.h"
+#include "board.h"
+
+#include <SDL2/SDL_render.h>
+#include <SDL2/SDL_surface.h>
+#include <SDL2/SDL_video.h>
+
+typedef enum {
+    TEXTURE_TILE_CLOSED,
+    TEXTURE_TILE_OPEN,
+    TEXTURE_MINE,
+    TEXTURE_MINE_FLAGGED,
+    TEXTURE_FLAG,
+    TEXTURE_NUMBERS,
+    TEXTURE_GAME_OVER,
+    TEXTURE_VICTORY,
+    TEXTURE_DIFFICULTIES,
+    TEXTURES_LEN,
+} Texture;
+
+typedef struct {
+    SDL_Window* window; // NULL when drawing offscreen
+    SDL_Renderer* renderer;
+    SDL_Texture* textures[TEXTURES_LEN];
+} Gfx;
+
+// Open a window with a hardware accelerated renderer
+Gfx gfx_init(const char* window_title, bool vsync);
+// Draw into surface with a software renderer. Needs neither
+// a display nor SDL_Init, and separate instances can be used
+// from separate threads.
+Gfx gfx_init_surface(SDL_Surface* surface);
+void gfx_deinit(const Gfx* self);
+void gfx_draw_tile(const Gfx* self, const Tile* tile, const SDL_FRect* dest, bool game_over, bool victory);
+
+#endif // __GFX_H__
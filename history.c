@@ -0,0 +1,263 @@
+#include "history.h"
+
+#include <string.h>
+
+// Number of chunks covered by a node at the given level
+static usize level_chunks(usize level)
+{
+    usize n = 1;
+    for (usize i = 0; i < level; i++) {
+        n *= HISTORY_FANOUT;
+    }
+    return n;
+}
+
+static HistoryNode* node_retain(HistoryNode* node)
+{
+    node->refs++;
+    return node;
+}
+
+static void node_release(HistoryNode* node, usize level)
+{
+    if (!node || --node->refs > 0) {
+        return;
+    }
+    if (level > 0) {
+        HistoryInner* inner = (HistoryInner*)node;
+        for (usize i = 0; i < HISTORY_FANOUT; i++) {
+            node_release(inner->children[i], level - 1);
+        }
+    }
+    free(node);
+}
+
+static HistoryNode* leaf_from_board(const History* self, const Board* board, usize chunk)
+{
+    HistoryLeaf* leaf;
+    if (!(leaf = malloc(sizeof(HistoryLeaf)))) {
+        panic("Out of memory!");
+    }
+    leaf->base.refs = 1;
+    usize start = chunk * HISTORY_CHUNK_TILES;
+    usize len = min(HISTORY_CHUNK_TILES, self->tiles_len - start);
+    memcpy(leaf->tiles, board->tiles + start, len * sizeof(Tile));
+    return &leaf->base;
+}
+
+static HistoryInner* inner_alloc(void)
+{
+    HistoryInner* inner;
+    if (!(inner = calloc(1, sizeof(HistoryInner)))) {
+        panic("Out of memory!");
+    }
+    inner->base.refs = 1;
+    return inner;
+}
+
+// Copy the whole board into a new tree
+static HistoryNode* node_build(const History* self, const Board* board, usize level, usize first_chunk)
+{
+    if (level == 0) {
+        return leaf_from_board(self, board, first_chunk);
+    }
+    HistoryInner* inner = inner_alloc();
+    usize child_chunks = level_chunks(level - 1);
+    for (usize i = 0; i < HISTORY_FANOUT; i++) {
+        usize chunk = first_chunk + i * child_chunks;
+        if (chunk >= self->chunks_len) {
+            break;
+        }
+        inner->children[i] = node_build(self, board, level - 1, chunk);
+    }
+    return &inner->base;
+}
+
+// Copy of old with the sorted dirty chunks replaced from the board,
+// sharing all untouched subtrees
+static HistoryNode* node_commit(const History* self, const Board* board, HistoryNode* old, usize level, usize first_chunk, const usize* dirty, usize dirty_len)
+{
+    if (dirty_len == 0) {
+        return node_retain(old);
+    }
+    if (level == 0) {
+        return leaf_from_board(self, board, first_chunk);
+    }
+    HistoryInner* inner = inner_alloc();
+    const HistoryInner* old_inner = (const HistoryInner*)old;
+    usize child_chunks = level_chunks(level - 1);
+    for (usize i = 0; i < HISTORY_FANOUT && old_inner->children[i]; i++) {
+        usize chunk = first_chunk + i * child_chunks;
+        usize n = 0;
+        while (n < dirty_len && dirty[n] < chunk + child_chunks) {
+            n++;
+        }
+        inner->children[i] = node_commit(self, board, old_inner->children[i], level - 1, chunk, dirty, n);
+        dirty += n;
+        dirty_len -= n;
+    }
+    return &inner->base;
+}
+
+static void history_changed(History* self, usize index, const Tile* old)
+{
+    if (self->changed_len == self->changed_cap) {
+        self->changed_cap = max(self->changed_cap * 2, 64);
+        if (!(self->changed = realloc(self->changed, self->changed_cap * sizeof(HistoryChange)))) {
+            panic("Out of memory!");
+        }
+    }
+    self->changed[self->changed_len++] = (HistoryChange) {
+        .index = index,
+        .old = *old,
+    };
+}
+
+// Write the tiles of to that differ from from into the board
+static void node_restore(History* self, Board* board, const HistoryNode* from, const HistoryNode* to, usize level, usize first_chunk)
+{
+    if (from == to) {
+        return;
+    }
+    if (level == 0) {
+        const HistoryLeaf* leaf = (const HistoryLeaf*)to;
+        usize start = first_chunk * HISTORY_CHUNK_TILES;
+        usize len = min(HISTORY_CHUNK_TILES, self->tiles_len - start);
+        for (usize i = 0; i < len; i++) {
+            Tile* tile = &board->tiles[start + i];
+            if (memcmp(tile, &leaf->tiles[i], sizeof(Tile)) != 0) {
+                history_changed(self, start + i, tile);
+                *tile = leaf->tiles[i];
+            }
+        }
+        return;
+    }
+    const HistoryInner* from_inner = (const HistoryInner*)from;
+    const HistoryInner* to_inner = (const HistoryInner*)to;
+    usize child_chunks = level_chunks(level - 1);
+    for (usize i = 0; i < HISTORY_FANOUT && to_inner->children[i]; i++) {
+        node_restore(self, board, from_inner->children[i], to_inner->children[i], level - 1, first_chunk + i * child_chunks);
+    }
+}
+
+static void history_push(History* self, Snapshot snapshot)
+{
+    // Drop the redo states
+    while (self->snapshots_len > self->cursor + 1) {
+        history_snapshot_release(self, self->snapshots[--self->snapshots_len]);
+    }
+    if (self->snapshots_len == self->snapshots_cap) {
+        self->snapshots_cap = max(self->snapshots_cap * 2, 16);
+        if (!(self->snapshots = realloc(self->snapshots, self->snapshots_cap * sizeof(Snapshot)))) {
+            panic("Out of memory!");
+        }
+    }
+    self->snapshots[self->snapshots_len++] = snapshot;
+    self->cursor = self->snapshots_len - 1;
+}
+
+History history_init(const Board* board)
+{
+    History self = {
+        // Padding tiles never change, but keeping them
+        // makes chunks plain ranges of the tile array
+        .tiles_len = board_tiles_len(board),
+    };
+    self.chunks_len = (self.tiles_len + HISTORY_CHUNK_TILES - 1) / HISTORY_CHUNK_TILES;
+    while (level_chunks(self.depth) < self.chunks_len) {
+        self.depth++;
+    }
+
+    if (!(self.dirty = calloc((self.chunks_len + 63) / 64, sizeof(u64)))
+        || !(self.dirty_chunks = malloc(self.chunks_len * sizeof(usize)))) {
+        panic("Out of memory!");
+    }
+
+    history_push(&self, (Snapshot) { node_build(&self, board, self.depth, 0) });
+
+    return self;
+}
+
+void history_deinit(History* self)
+{
+    for (usize i = 0; i < self->snapshots_len; i++) {
+        history_snapshot_release(self, self->snapshots[i]);
+    }
+    free(self->snapshots);
+    free(self->dirty);
+    free(self->dirty_chunks);
+    free(self->changed);
+}
+
+void history_touch(History* self, usize index)
+{
+    usize chunk = index / HISTORY_CHUNK_TILES;
+    u64 bit = (u64)1 << (chunk % 64);
+    if (!(self->dirty[chunk / 64] & bit)) {
+        self->dirty[chunk / 64] |= bit;
+        self->dirty_chunks[self->dirty_len++] = chunk;
+    }
+}
+
+static int compare_usize(const void* a, const void* b)
+{
+    usize x = *(const usize*)a, y = *(const usize*)b;
+    return (x > y) - (x < y);
+}
+
+void history_commit(History* self, const Board* board)
+{
+    if (self->dirty_len == 0) {
+        return;
+    }
+
+    qsort(self->dirty_chunks, self->dirty_len, sizeof(usize), compare_usize);
+    Snapshot snapshot = {
+        node_commit(self, board, self->snapshots[self->cursor].root, self->depth, 0, self->dirty_chunks, self->dirty_len),
+    };
+
+    for (usize i = 0; i < self->dirty_len; i++) {
+        self->dirty[self->dirty_chunks[i] / 64] = 0;
+    }
+    self->dirty_len = 0;
+
+    history_push(self, snapshot);
+}
+
+bool history_undo(History* self, Board* board)
+{
+    history_commit(self, board);
+    if (self->cursor == 0) {
+        return false;
+    }
+    node_restore(self, board, self->snapshots[self->cursor].root, self->snapshots[self->cursor - 1].root, self->depth, 0);
+    self->cursor--;
+    return true;
+}
+
+bool history_redo(History* self, Board* board)
+{
+    if (self->dirty_len > 0 || self->cursor + 1 >= self->snapshots_len) {
+        return false;
+    }
+    node_restore(self, board, self->snapshots[self->cursor].root, self->snapshots[self->cursor + 1].root, self->depth, 0);
+    self->cursor++;
+    return true;
+}
+
+Snapshot history_snapshot(History* self)
+{
+    return (Snapshot) { node_retain(self->snapshots[self->cursor].root) };
+}
+
+void history_snapshot_release(History* self, Snapshot snapshot)
+{
+    node_release(snapshot.root, self->depth);
+}
+
+void history_checkout(History* self, Board* board, Snapshot snapshot)
+{
+    history_commit(self, board);
+    node_restore(self, board, self->snapshots[self->cursor].root, snapshot.root, self->depth, 0);
+    history_push(self, (Snapshot) { node_retain(snapshot.root) });
+}
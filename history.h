@@ -0,0 +1,87 @@
+#ifndef __HISTORY_H__
+#define __HISTORY_H__
+
+#include "main.h"
+#include "board.h"
+
+// Undo/redo and branching for boards through copy-on-write snapshots.
+//
+// A snapshot is a persistent tree: leaves hold fixed-size chunks of
+// tiles and are reference counted, so snapshots share every chunk
+// that didn't change between them. Committing a snapshot copies only
+// the chunks touched since the last commit (plus their path to the
+// root), and restoring one only visits subtrees that differ from the
+// board's current snapshot. Not thread-safe.
+//
+// Only the history is chunked: the board being played stays a flat
+// tile array, and chunks are copied from it on commit.
+
+#define HISTORY_CHUNK_TILES 1024
+#define HISTORY_FANOUT 32
+
+typedef struct {
+    usize refs;
+} HistoryNode;
+
+// Nodes at level 0 are leaves, all others are inner nodes. Missing
+// children past the end of the board are NULL.
+typedef struct {
+    HistoryNode base;
+    Tile tiles[HISTORY_CHUNK_TILES];
+} HistoryLeaf;
+
+typedef struct {
+    HistoryNode base;
+    HistoryNode* children[HISTORY_FANOUT];
+} HistoryInner;
+
+typedef struct {
+    HistoryNode* root;
+} Snapshot;
+
+typedef struct {
+    usize index;
+    Tile old;
+} HistoryChange;
+
+typedef struct {
+    usize tiles_len;
+    usize chunks_len;
+    usize depth; // levels above the leaves
+    // snapshots[cursor] is the state of the board at the last commit,
+    // later entries can be restored with history_redo
+    Snapshot* snapshots;
+    usize snapshots_len;
+    usize snapshots_cap;
+    usize cursor;
+    // Chunks touched since the last commit
+    u64* dirty;
+    usize* dirty_chunks;
+    usize dirty_len;
+    // Tiles changed by undo, redo and checkout, with their
+    // previous state, until the caller resets changed_len
+    HistoryChange* changed;
+    usize changed_len;
+    usize changed_cap;
+} History;
+
+// Start a history with the current state of the board
+History history_init(const Board* board);
+void history_deinit(History* self);
+// Mark the tile at index as changed since the last commit
+void history_touch(History* self, usize index);
+// Snapshot the board, if any tiles were touched since the last commit.
+// Discards all states that could have been restored with history_redo.
+void history_commit(History* self, const Board* board);
+// Restore the board to the previous or next snapshot, returns false
+// if there is none
+bool history_undo(History* self, Board* board);
+bool history_redo(History* self, Board* board);
+// Get a reference to the last committed snapshot, e.g. to explore
+// a "what if" branch and come back to it with history_checkout
+Snapshot history_snapshot(History* self);
+void history_snapshot_release(History* self, Snapshot snapshot);
+// Restore the board to snapshot and commit it as a new state
+void history_checkout(History* self, Board* board, Snapshot snapshot);
+
+#endif // __HISTORY_H__
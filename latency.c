@@ -0,0 +1,87 @@
+#include "latency.h"
+
+#include <SDL2/SDL_timer.h>
+
+static void latency_stats_add(LatencyStats* self, f32 ms)
+{
+    if (self->len == self->cap) {
+        self->cap = max(self->cap * 2, 256);
+        if (!(self->samples = realloc(self->samples, self->cap * sizeof(f32)))) {
+            panic("Out of memory!");
+        }
+    }
+    self->samples[self->len++] = ms;
+}
+
+static int compare_f32(const void* a, const void* b)
+{
+    f32 x = *(const f32*)a, y = *(const f32*)b;
+    return (x > y) - (x < y);
+}
+
+static void latency_stats_print(LatencyStats* self, const char* name)
+{
+    if (self->len == 0) {
+        return;
+    }
+    qsort(self->samples, self->len, sizeof(f32), compare_f32);
+    f64 sum = 0.0;
+    for (usize i = 0; i < self->len; i++) {
+        sum += self->samples[i];
+    }
+    printf("%-17s n=" USIZE " mean=%.2f p50=%.2f p90=%.2f p99=%.2f max=%.2f (ms)\n",
+        name, self->len, sum / self->len,
+        self->samples[self->len / 2],
+        self->samples[self->len * 90 / 100],
+        self->samples[self->len * 99 / 100],
+        self->samples[self->len - 1]);
+}
+
+LatencyProbe latency_probe_init(void)
+{
+    return (LatencyProbe) { 0 };
+}
+
+void latency_probe_deinit(const LatencyProbe* self)
+{
+    free(self->event_to_present.samples);
+    free(self->poll_to_present.samples);
+}
+
+void latency_probe_input(LatencyProbe* self, u32 timestamp, usize seq)
+{
+    if (self->pending_len == LATENCY_MAX_PENDING) {
+        return;
+    }
+    self->pending_timestamps[self->pending_len] = timestamp;
+    self->pending_polled[self->pending_len] = SDL_GetPerformanceCounter();
+    self->pending_seqs[self->pending_len] = seq;
+    self->pending_len++;
+}
+
+void latency_probe_present(LatencyProbe* self, usize presented)
+{
+    u32 ticks = SDL_GetTicks();
+    u64 counter = SDL_GetPerformanceCounter();
+    f64 freq = SDL_GetPerformanceFrequency();
+    // Inputs whose result isn't shown yet stay pending, in order
+    usize kept = 0;
+    for (usize i = 0; i < self->pending_len; i++) {
+        if (self->pending_seqs[i] > presented) {
+            self->pending_timestamps[kept] = self->pending_timestamps[i];
+            self->pending_polled[kept] = self->pending_polled[i];
+            self->pending_seqs[kept] = self->pending_seqs[i];
+            kept++;
+            continue;
+        }
+        latency_stats_add(&self->event_to_present, ticks - self->pending_timestamps[i]);
+        latency_stats_add(&self->poll_to_present, (counter - self->pending_polled[i]) * 1000.0 / freq);
+    }
+    self->pending_len = kept;
+}
+
+void latency_probe_print(LatencyProbe* self)
+{
+    latency_stats_print(&self->event_to_present, "event to present:");
+    latency_stats_print(&self->poll_to_present, "poll to present:");
+}
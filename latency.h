@@ -0,0 +1,42 @@
+#ifndef __LATENCY_H__
+#define __LATENCY_H__
+
+#include "main.h"
+
+// Input-to-present latency probe. Every input event that results in a
+// game command is matched with the first SDL_RenderPresent showing the
+// command's result, measured both from the event's timestamp (which
+// includes the time it waited in the queue, but only has millisecond
+// resolution) and from the moment it was polled.
+
+// Inputs waiting for their result to be presented,
+// any further inputs are not measured
+#define LATENCY_MAX_PENDING 64
+
+typedef struct {
+    f32* samples; // in milliseconds
+    usize len;
+    usize cap;
+} LatencyStats;
+
+typedef struct {
+    u32 pending_timestamps[LATENCY_MAX_PENDING];
+    u64 pending_polled[LATENCY_MAX_PENDING];
+    usize pending_seqs[LATENCY_MAX_PENDING];
+    usize pending_len;
+    LatencyStats event_to_present;
+    LatencyStats poll_to_present;
+} LatencyProbe;
+
+LatencyProbe latency_probe_init(void);
+void latency_probe_deinit(const LatencyProbe* self);
+// Record an input event, with timestamp from its SDL_CommonEvent and
+// the sequence number of the game command it resulted in
+void latency_probe_input(LatencyProbe* self, u32 timestamp, usize seq);
+// Call right after SDL_RenderPresent, with the sequence number of the
+// last command whose result was presented
+void latency_probe_present(LatencyProbe* self, usize presented);
+// Print the latency distributions
+void latency_probe_print(LatencyProbe* self);
+
+#endif // __LATENCY_H__
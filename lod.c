@@ -0,0 +1,147 @@
+#include "lod.h"
+
+#include <string.h>
+
+Lod lod_init(usize board_w, usize board_h)
+{
+    Lod self = {
+        .board_w = board_w,
+        .board_h = board_h,
+    };
+
+    for (usize shift = LOD_BASE_SHIFT; self.levels_len < LOD_MAX_LEVELS; shift++) {
+        LodLevel* level = &self.levels[self.levels_len++];
+        level->w = (board_w + ((usize)1 << shift) - 1) >> shift;
+        level->h = (board_h + ((usize)1 << shift) - 1) >> shift;
+        if (!(level->open = calloc(level->w * level->h, sizeof(u32)))
+            || !(level->flag = calloc(level->w * level->h, sizeof(u32)))) {
+            panic("Out of memory!");
+        }
+        if (level->w == 1 && level->h == 1) {
+            break;
+        }
+    }
+
+    return self;
+}
+
+void lod_deinit(const Lod* self)
+{
+    for (usize i = 0; i < self->levels_len; i++) {
+        free(self->levels[i].open);
+        free(self->levels[i].flag);
+        if (self->levels[i].texture) {
+            SDL_DestroyTexture(self->levels[i].texture);
+        }
+    }
+}
+
+void lod_update(Lod* self, usize x, usize y, i32 d_open, i32 d_flag)
+{
+    for (usize i = 0; i < self->levels_len; i++) {
+        LodLevel* level = &self->levels[i];
+        usize bx = x >> (LOD_BASE_SHIFT + i);
+        usize by = y >> (LOD_BASE_SHIFT + i);
+        usize index = by * level->w + bx;
+        level->open[index] += d_open;
+        level->flag[index] += d_flag;
+
+        if (level->dirty_x0 >= level->dirty_x1) {
+            level->dirty_x0 = bx;
+            level->dirty_y0 = by;
+            level->dirty_x1 = bx + 1;
+            level->dirty_y1 = by + 1;
+        } else {
+            level->dirty_x0 = min(level->dirty_x0, bx);
+            level->dirty_y0 = min(level->dirty_y0, by);
+            level->dirty_x1 = max(level->dirty_x1, bx + 1);
+            level->dirty_y1 = max(level->dirty_y1, by + 1);
+        }
+    }
+}
+
+static void lod_upload(Lod* self, usize level_index, SDL_Renderer* renderer)
+{
+    LodLevel* level = &self->levels[level_index];
+    usize shift = LOD_BASE_SHIFT + level_index;
+
+    if (!level->texture) {
+        level->texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32,
+            SDL_TEXTUREACCESS_STREAMING,
+            level->w, level->h);
+        if (!level->texture) {
+            panic("failed to create LOD texture: %s", SDL_GetError());
+        }
+        SDL_SetTextureScaleMode(level->texture, SDL_ScaleModeLinear);
+        // A new texture has undefined contents
+        level->dirty_x0 = 0;
+        level->dirty_y0 = 0;
+        level->dirty_x1 = level->w;
+        level->dirty_y1 = level->h;
+    }
+
+    if (level->dirty_x0 >= level->dirty_x1) {
+        return;
+    }
+
+    SDL_Rect rect = {
+        level->dirty_x0,
+        level->dirty_y0,
+        level->dirty_x1 - level->dirty_x0,
+        level->dirty_y1 - level->dirty_y0,
+    };
+    u8* pixels;
+    int pitch;
+    if (SDL_LockTexture(level->texture, &rect, (void**)&pixels, &pitch) < 0) {
+        panic("failed to lock LOD texture: %s", SDL_GetError());
+    }
+    for (usize by = level->dirty_y0; by < level->dirty_y1; by++) {
+        u8* row = pixels + (by - level->dirty_y0) * pitch;
+        for (usize bx = level->dirty_x0; bx < level->dirty_x1; bx++) {
+            // Blocks at the right and bottom edge may be cut off
+            usize tiles_w = min((usize)1 << shift, self->board_w - (bx << shift));
+            usize tiles_h = min((usize)1 << shift, self->board_h - (by << shift));
+            f32 total = tiles_w * tiles_h;
+            f32 open = level->open[by * level->w + bx] / total;
+            f32 flag = min(level->flag[by * level->w + bx] / total, 1.0 - open);
+            f32 closed = 1.0 - open - flag;
+
+            u8* pixel = row + (bx - level->dirty_x0) * 4;
+            pixel[0] = closed * 160 + open * 220 + flag * 200;
+            pixel[1] = closed * 160 + open * 220 + flag * 40;
+            pixel[2] = closed * 160 + open * 220 + flag * 40;
+            pixel[3] = 255;
+        }
+    }
+    SDL_UnlockTexture(level->texture);
+
+    level->dirty_x0 = level->dirty_x1 = 0;
+    level->dirty_y0 = level->dirty_y1 = 0;
+}
+
+void lod_draw(Lod* self, SDL_Renderer* renderer, const SDL_FRect* dest, f32 tile_size)
+{
+    // Pick the finest level with at least one pixel per block,
+    // that isn't too large for a texture
+    usize level_index = 0;
+    while (level_index + 1 < self->levels_len
+        && (((usize)1 << (LOD_BASE_SHIFT + level_index)) * tile_size < 1.0
+            || self->levels[level_index].w > LOD_MAX_TEXTURE_SIZE
+            || self->levels[level_index].h > LOD_MAX_TEXTURE_SIZE)) {
+        level_index++;
+    }
+
+    lod_upload(self, level_index, renderer);
+
+    // The last block in each direction may only be partially
+    // covered by the board, so the texture overhangs slightly
+    LodLevel* level = &self->levels[level_index];
+    f32 block_size = ((usize)1 << (LOD_BASE_SHIFT + level_index)) * tile_size;
+    SDL_FRect texture_dest = {
+        dest->x,
+        dest->y,
+        level->w * block_size,
+        level->h * block_size,
+    };
+    SDL_RenderCopyF(renderer, level->texture, NULL, &texture_dest);
+}
@@ -0,0 +1,51 @@
+#ifndef __LOD_H__
+#define __LOD_H__
+
+#include "main.h"
+
+#include <SDL2/SDL_render.h>
+
+// Level of detail pyramid for drawing boards whose tiles are smaller
+// than a pixel. Every level aggregates square blocks of tiles into
+// open and flagged counts, twice as large as the level below, and is
+// mirrored into a streaming texture on demand, so a board of any
+// size is drawn with a single texture copy.
+
+// Level 0 aggregates blocks of 2x2 tiles, so below LOD_TILE_SIZE the
+// level drawn always has blocks of 1 to 2 pixels
+#define LOD_BASE_SHIFT 1
+#define LOD_MAX_LEVELS 32
+// Below this many pixels per tile the pyramid is drawn instead of tiles
+#define LOD_TILE_SIZE 1.0
+// Largest texture created for a level
+#define LOD_MAX_TEXTURE_SIZE 4096
+
+typedef struct {
+    usize w; // in blocks
+    usize h;
+    u32* open;
+    u32* flag;
+    SDL_Texture* texture;
+    // Blocks changed since the texture was last updated,
+    // x1 and y1 are exclusive
+    usize dirty_x0;
+    usize dirty_y0;
+    usize dirty_x1;
+    usize dirty_y1;
+} LodLevel;
+
+typedef struct {
+    usize board_w;
+    usize board_h;
+    LodLevel levels[LOD_MAX_LEVELS];
+    usize levels_len;
+} Lod;
+
+Lod lod_init(usize board_w, usize board_h);
+void lod_deinit(const Lod* self);
+// Record a change of the open and flag state of the tile at x and y
+void lod_update(Lod* self, usize x, usize y, i32 d_open, i32 d_flag);
+// Draw the level best matching tile_size (in pixels) into dest
+void lod_draw(Lod* self, SDL_Renderer* renderer, const SDL_FRect* dest, f32 tile_size);
+
+#endif // __LOD_H__
@@ -1,398 +1,460 @@
 #include "main.h"
-#include "data.gen.h"
-#include "rng.h"
+#include "board.h"
+#include "endless.h"
+#include "game.h"
+#include "gfx.h"
+#include "latency.h"
+#include "lod.h"
 
 #include <SDL2/SDL.h>
-#include <SDL2/SDL_image.h>
 #include <SDL2/SDL_keyboard.h>
 #include <SDL2/SDL_render.h>
-#include <SDL2/SDL_rwops.h>
 #include <SDL2/SDL_video.h>
 
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 
-typedef enum {
-    TEXTURE_TILE_CLOSED,
-    TEXTURE_TILE_OPEN,
-    TEXTURE_MINE,
-    TEXTURE_MINE_FLAGGED,
-    TEXTURE_FLAG,
-    TEXTURE_NUMBERS,
-    TEXTURE_GAME_OVER,
-    TEXTURE_VICTORY,
-    TEXTURE_DIFFICULTIES,
-    TEXTURES_LEN,
-} Texture;
-
-typedef struct {
-    SDL_Window* window;
-    SDL_Renderer* renderer;
-    SDL_Texture* textures[TEXTURES_LEN];
-} Gfx;
-
-static SDL_Texture* load_texture(SDL_Renderer* renderer, const u8* mem, usize mem_len)
-{
-    return IMG_LoadTexture_RW(renderer, SDL_RWFromConstMem(mem, mem_len), 1);
-}
+// Maximum number of chunks generated per frame for drawing
+#define ENDLESS_PREFETCH_PER_FRAME 4
+// Maximum number of queued tiles and generated chunks per frame of a reveal
+#define ENDLESS_REVEAL_TILES_PER_FRAME 4096
+#define ENDLESS_REVEAL_CHUNKS_PER_FRAME 4
 
-static Gfx gfx_init(const char* window_title)
+static void endless_run(const Gfx* gfx, u64 seed)
 {
-    if (SDL_Init(SDL_INIT_VIDEO) < 0) {
-        panic("failed to initialize SDL: %s", SDL_GetError());
-    }
-
-    SDL_Rect display_bounds;
-    SDL_GetDisplayUsableBounds(0, &display_bounds);
+    EndlessBoard board = endless_init(seed);
+    EndlessExplorer explorer = endless_explorer_init();
 
-    SDL_Window* window = SDL_CreateWindow(window_title,
-        SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED,
-        display_bounds.w * 0.8, display_bounds.h * 0.8,
-        SDL_WINDOW_RESIZABLE);
-    if (!window) {
-        panic("failed to initialize window: %s", SDL_GetError());
-    }
+    // Tile coordinates at the center of the screen
+    f64 camera_x = 0.5, camera_y = 0.5;
+    f32 tile_size = 32.0;
 
-    SDL_Renderer* renderer = SDL_CreateRenderer(window,
-        -1,
-        SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
-
-    Gfx self = {
-        .window = window,
-        .renderer = renderer,
-    };
-    self.textures[TEXTURE_TILE_CLOSED] = load_texture(renderer, data_tile_closed_png, arrlen(data_tile_closed_png));
-    self.textures[TEXTURE_TILE_OPEN] = load_texture(renderer, data_tile_open_png, arrlen(data_tile_open_png));
-    self.textures[TEXTURE_MINE] = load_texture(renderer, data_mine_png, arrlen(data_mine_png));
-    self.textures[TEXTURE_MINE_FLAGGED] = load_texture(renderer, data_mine_flagged_png, arrlen(data_mine_flagged_png));
-    self.textures[TEXTURE_FLAG] = load_texture(renderer, data_flag_png, arrlen(data_flag_png));
-    self.textures[TEXTURE_NUMBERS] = load_texture(renderer, data_numbers_png, arrlen(data_numbers_png));
-    self.textures[TEXTURE_GAME_OVER] = load_texture(renderer, data_game_over_png, arrlen(data_game_over_png));
-    self.textures[TEXTURE_VICTORY] = load_texture(renderer, data_victory_png, arrlen(data_victory_png));
-    self.textures[TEXTURE_DIFFICULTIES] = load_texture(renderer, data_difficulties_png, arrlen(data_difficulties_png));
-
-    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-
-    return self;
-}
-
-static void gfx_deinit(const Gfx* self)
-{
-    for (usize i = 0; i < arrlen(self->textures); i++) {
-        SDL_DestroyTexture(self->textures[i]);
-    }
-    SDL_DestroyRenderer(self->renderer);
-    SDL_DestroyWindow(self->window);
-    SDL_Quit();
-}
-
-typedef struct {
-    bool mine;
-    bool flag;
-    bool open;
-    u8 nearby_mines;
-} Tile;
-
-typedef struct {
-    Tile* tiles;
-    usize w;
-    usize h;
-} Board;
+    bool run = true;
+    bool game_over = false;
+    while (run) {
+        int render_w, render_h;
+        SDL_GetRendererOutputSize(gfx->renderer, &render_w, &render_h);
 
-static Board board_init(usize width, usize height)
-{
-    Board self = {
-        .w = width,
-        .h = height,
-    };
+        // Screen position of tile 0, 0
+        f64 origin_x = render_w / 2.0 - camera_x * tile_size;
+        f64 origin_y = render_h / 2.0 - camera_y * tile_size;
 
-    if (!(self.tiles = calloc(self.w * self.h, sizeof(Tile)))) {
-        panic("Out of memory!");
-    }
+        SDL_Event event;
+        while (SDL_PollEvent(&event)) {
+            switch (event.type) {
+            case SDL_QUIT:
+                run = false;
+                break;
+            case SDL_KEYDOWN:
+                switch (event.key.keysym.sym) {
+                case SDLK_LEFT:
+                    camera_x -= 4.0;
+                    break;
+                case SDLK_RIGHT:
+                    camera_x += 4.0;
+                    break;
+                case SDLK_UP:
+                    camera_y -= 4.0;
+                    break;
+                case SDLK_DOWN:
+                    camera_y += 4.0;
+                    break;
+                default:
+                    if (game_over) {
+                        endless_deinit(&board);
+                        board = endless_init(++seed);
+                        endless_explorer_deinit(&explorer);
+                        explorer = endless_explorer_init();
+                        camera_x = 0.5;
+                        camera_y = 0.5;
+                        game_over = false;
+                    }
+                    break;
+                }
+                break;
+            case SDL_MOUSEWHEEL:
+                tile_size = event.wheel.y > 0 ? tile_size * 1.25 : tile_size / 1.25;
+                tile_size = max(min(tile_size, 128.0), 16.0);
+                break;
+            case SDL_MOUSEMOTION:
+                if (event.motion.state & SDL_BUTTON(SDL_BUTTON_MIDDLE)) {
+                    camera_x -= event.motion.xrel / tile_size;
+                    camera_y -= event.motion.yrel / tile_size;
+                }
+                break;
+            case SDL_MOUSEBUTTONDOWN:
+                if (!game_over) {
+                    i64 tile_x = floor((event.button.x - origin_x) / tile_size);
+                    i64 tile_y = floor((event.button.y - origin_y) / tile_size);
+                    Tile tile;
+                    endless_tile(&board, tile_x, tile_y, &tile);
+                    switch (event.button.button) {
+                    case SDL_BUTTON_LEFT:
+                        if (!tile.flag && !endless_explorer_start(&explorer, &board, tile_x, tile_y)) {
+                            game_over = true;
+                        }
+                        break;
+                    case SDL_BUTTON_RIGHT:
+                        endless_flag(&board, tile_x, tile_y);
+                        break;
+                    }
+                }
+                break;
+            }
+        }
 
-    return self;
-}
+        // Reveals are spread over several frames
+        // like on the regular board
+        endless_explorer_step(&explorer, &board, ENDLESS_REVEAL_TILES_PER_FRAME, ENDLESS_REVEAL_CHUNKS_PER_FRAME);
 
-static void board_deinit(const Board* self)
-{
-    free(self->tiles);
-}
+        origin_x = render_w / 2.0 - camera_x * tile_size;
+        origin_y = render_h / 2.0 - camera_y * tile_size;
+        i64 x0 = floor(-origin_x / tile_size);
+        i64 y0 = floor(-origin_y / tile_size);
+        i64 x1 = floor((render_w - origin_x) / tile_size);
+        i64 y1 = floor((render_h - origin_y) / tile_size);
 
-static void board_generate(Board* self, RNG* rng, usize mines, usize safe_x, usize safe_y)
-{
-    usize* random_tile_indices;
-    if (!(random_tile_indices = calloc(self->w * self->h, sizeof(usize)))) {
-        panic("Out of memory!");
-    }
-    for (usize i = 0; i < self->w * self->h; i++) {
-        random_tile_indices[i] = i;
-    }
+        // Chunks that were compressed while off-screen are regenerated
+        // a few at a time, their numbers pop in over the next frames
+        endless_prefetch(&board, x0, y0, x1, y1, ENDLESS_PREFETCH_PER_FRAME);
 
-    // Fisher-Yates shuffle
-    for (usize i = self->w * self->h - 1; i > 0; i--) {
-        usize j = rng_u64_cap(rng, i + 1);
-        swap(usize, random_tile_indices[i], random_tile_indices[j]);
-    }
+        SDL_SetRenderDrawColor(gfx->renderer, 128, 128, 128, 255);
+        SDL_RenderClear(gfx->renderer);
 
-    // Place mines, ensuring that there is a 3x3 "safe" area around safe_x and safe_y
-    for (usize i = 0, n = 0; n < mines; i++) {
-        isize offsets[9][2] = {
-            { -1, -1 },
-            { 0, -1 },
-            { 1, -1 },
-            { -1, 0 },
-            { 0, 0 },
-            { 1, 0 },
-            { -1, 1 },
-            { 0, 1 },
-            { 1, 1 },
-        };
-        bool outside_safe_area = true;
-        for (usize j = 0; j < arrlen(offsets); j++) {
-            isize sx = safe_x + offsets[j][0];
-            isize sy = safe_y + offsets[j][1];
-            if (sx < 0 || sy < 0 || sx >= self->w || sy >= self->h) {
-                continue;
-            }
-	    usize safe_tile_index = sy * self->w + sx;
-            if (safe_tile_index == random_tile_indices[i]) {
-                outside_safe_area = false;
-                break;
+        for (i64 y = y0; y <= y1; y++) {
+            for (i64 x = x0; x <= x1; x++) {
+                Tile tile;
+                endless_tile(&board, x, y, &tile);
+                SDL_FRect dest = {
+                    origin_x + x * tile_size,
+                    origin_y + y * tile_size,
+                    tile_size,
+                    tile_size,
+                };
+                gfx_draw_tile(gfx, &tile, &dest, game_over, false);
             }
         }
-	if (i >= self->w * self->h) {
-		panic("ran out of tile indices placing while mines");
-	}
-        if (outside_safe_area) {
-            self->tiles[random_tile_indices[i]].mine = true;
-            n++;
-        }
-    }
 
-    free(random_tile_indices);
-
-    for (usize y = 0; y < self->h; y++) {
-        for (usize x = 0; x < self->w; x++) {
-            isize offsets[8][2] = {
-                { -1, -1 },
-                { 0, -1 },
-                { 1, -1 },
-                { -1, 0 },
-                { 1, 0 },
-                { -1, 1 },
-                { 0, 1 },
-                { 1, 1 },
+        if (game_over) {
+            f32 w = min(render_w, render_h);
+            SDL_FRect dest = {
+                (render_w - w) / 2.0,
+                (render_h - w / 2.0) / 2.0,
+                w,
+                w / 480.0 * 240.0,
             };
-            for (usize i = 0; i < arrlen(offsets); i++) {
-                isize cx = x + offsets[i][0];
-                isize cy = y + offsets[i][1];
-                if (cx < 0 || cy < 0 || cx >= self->w || cy >= self->h) {
-                    continue;
-                }
-                if (self->tiles[cy * self->w + cx].mine) {
-                    self->tiles[y * self->w + x].nearby_mines++;
-                }
-            }
+            SDL_RenderCopyF(gfx->renderer, gfx->textures[TEXTURE_GAME_OVER],
+                NULL,
+                &dest);
         }
+
+        SDL_RenderPresent(gfx->renderer);
     }
+
+    endless_explorer_deinit(&explorer);
+    endless_deinit(&board);
 }
 
-static void board_explore(Board* self, usize x, usize y)
+typedef enum {
+    PACING_VSYNC, // wait for vblank when presenting
+    PACING_UNCAPPED, // render as fast as possible
+    PACING_LATE_LATCH, // wait for vblank, but handle input as late as possible
+    PACINGS_LEN,
+} Pacing;
+
+static const char* pacing_names[PACINGS_LEN] = {
+    [PACING_VSYNC] = "vsync",
+    [PACING_UNCAPPED] = "uncapped",
+    [PACING_LATE_LATCH] = "late-latch",
+};
+
+// Time left for the driver to present a late-latched frame before vblank
+#define LATE_LATCH_MARGIN_MS 2.0
+// Longest a late-latched frame waits for the game thread to handle its
+// input, so it can show the result instead of the frame after
+#define LATE_LATCH_RESULT_MS 2
+
+// Wait until just enough time is left before the next vblank
+// to handle input, draw and present the frame
+static void late_latch_wait(u64 last_present, f64 frame_period_ms, f64 frame_work_ms)
 {
-    usize index = y * self->w + x;
-
-    if (self->tiles[index].open) {
+    f64 freq = SDL_GetPerformanceFrequency();
+    f64 wait_ms = frame_period_ms - frame_work_ms - LATE_LATCH_MARGIN_MS;
+    if (wait_ms <= 0.0) {
         return;
     }
-    self->tiles[index].open = true;
-
-    if (self->tiles[index].nearby_mines > 0) {
-        return;
+    u64 target = last_present + (u64)(wait_ms / 1000.0 * freq);
+    for (;;) {
+        u64 now = SDL_GetPerformanceCounter();
+        if (now >= target) {
+            break;
+        }
+        // SDL_Delay is coarse, so spin for the last millisecond
+        f64 remaining_ms = (target - now) * 1000.0 / freq;
+        if (remaining_ms > 1.5) {
+            SDL_Delay(remaining_ms - 1.0);
+        }
     }
+}
 
-    isize offsets[8][2] = {
-        { -1, -1 },
-        { 0, -1 },
-        { 1, -1 },
-        { -1, 0 },
-        { 1, 0 },
-        { -1, 1 },
-        { 0, 1 },
-        { 1, 1 },
-    };
-    for (usize i = 0; i < arrlen(offsets); i++) {
-        isize cx = x + offsets[i][0];
-        isize cy = y + offsets[i][1];
-        if (cx < 0 || cy < 0 || cx >= self->w || cy >= self->h) {
-            continue;
+// Tiles of the render thread's copy of the board brought up to date
+// per frame, so a change to all of a huge board doesn't drop frames
+#define SYNC_TILES_PER_FRAME ((usize)1 << 18)
+
+// Bring at most SYNC_TILES_PER_FRAME tiles of board and lod within
+// pending up to date with a snapshot from the game thread, and remove
+// them from pending. Tiles outside pending must already be up to date.
+// Returns true once all of board matches the snapshot.
+static bool game_sync(Board* board, Lod* lod, GameRect* pending, const GameSnapshot* snapshot)
+{
+    if (snapshot->board.w != board->w || snapshot->board.h != board->h) {
+        board_deinit(board);
+        lod_deinit(lod);
+        *board = board_init(snapshot->board.w, snapshot->board.h);
+        *lod = lod_init(board->w, board->h);
+        *pending = (GameRect) { 0, 0, board->w, board->h };
+    }
+    if (pending->x0 >= pending->x1) {
+        return true;
+    }
+    usize rows = max(SYNC_TILES_PER_FRAME / (pending->x1 - pending->x0), 1);
+    usize y1 = min(pending->y0 + rows, pending->y1);
+    for (usize y = pending->y0; y < y1; y++) {
+        for (usize x = pending->x0; x < pending->x1; x++) {
+            Tile* tile = &board->tiles[board_index(board, x, y)];
+            const Tile* next = &snapshot->board.tiles[board_index(&snapshot->board, x, y)];
+            if (tile->open != next->open || tile->flag != next->flag) {
+                lod_update(lod, x, y,
+                    (i32)next->open - (i32)tile->open,
+                    (i32)next->flag - (i32)tile->flag);
+            }
+            *tile = *next;
         }
-        board_explore(self, cx, cy);
     }
+    pending->y0 = y1;
+    if (pending->y0 < pending->y1) {
+        return false;
+    }
+    *pending = (GameRect) { 0 };
+    return true;
 }
 
-typedef enum {
-    DIFFICULTY_EASY,
-    DIFFICULTY_MEDIUM,
-    DIFFICULTY_HARD,
-    DIFFICULTIES_LEN,
-} Difficulty;
+static void print_usage(int argc, const char** argv)
+{
+    const char* progname = argc > 0 ? argv[0] : "minesweeper";
+    fprintf(stderr, "Usage:\n");
+    fprintf(stderr, "  %s [options]\n", progname);
+    fprintf(stderr, "Options:\n");
+    fprintf(stderr, "  -s <width>x<height> -- custom board size (requires -m)\n");
+    fprintf(stderr, "  -m <number>         -- number of mines on the custom board\n");
+    fprintf(stderr, "  -w                  -- wrap the edges of the board around (torus)\n");
+    fprintf(stderr, "  -e                  -- endless mode\n");
+    fprintf(stderr, "  -p <mode>           -- frame pacing: vsync (default), uncapped or late-latch\n");
+}
 
 int main(int argc, const char** argv)
 {
-    Gfx gfx = gfx_init("Minesweeper");
+    // Parse options
+    usize custom_w = 0, custom_h = 0, custom_mines = 0;
+    bool endless = false;
+    BoardTopology topology = BOARD_TOPOLOGY_BOUNDED;
+    Pacing pacing = PACING_VSYNC;
+    for (int i = 1; i < argc; i++) {
+        const char* param = i + 1 < argc ? argv[i + 1] : NULL;
+        if (strcmp(argv[i], "-s") == 0 && param) {
+            if (sscanf(param, USIZE "x" USIZE, &custom_w, &custom_h) != 2) {
+                print_usage(argc, argv);
+                return 1;
+            }
+            i++;
+        } else if (strcmp(argv[i], "-m") == 0 && param) {
+            if (sscanf(param, USIZE, &custom_mines) != 1) {
+                print_usage(argc, argv);
+                return 1;
+            }
+            i++;
+        } else if (strcmp(argv[i], "-w") == 0) {
+            topology = BOARD_TOPOLOGY_TORUS;
+        } else if (strcmp(argv[i], "-e") == 0) {
+            endless = true;
+        } else if (strcmp(argv[i], "-p") == 0 && param) {
+            pacing = PACINGS_LEN;
+            for (usize j = 0; j < PACINGS_LEN; j++) {
+                if (strcmp(param, pacing_names[j]) == 0) {
+                    pacing = j;
+                }
+            }
+            if (pacing == PACINGS_LEN) {
+                print_usage(argc, argv);
+                return 1;
+            }
+            i++;
+        } else {
+            print_usage(argc, argv);
+            return 1;
+        }
+    }
+    bool custom = custom_w > 0 || custom_h > 0 || custom_mines > 0;
+    if (custom && (custom_w == 0 || custom_h == 0 || custom_mines == 0)) {
+        print_usage(argc, argv);
+        return 1;
+    }
+    if (custom && custom_mines + 9 > custom_w * custom_h) {
+        log_err("too many mines for a " USIZE "x" USIZE " board", custom_w, custom_h);
+        return 1;
+    }
+    if (custom && topology == BOARD_TOPOLOGY_TORUS && (custom_w < 3 || custom_h < 3)) {
+        log_err("a torus needs a board of at least 3x3");
+        return 1;
+    }
 
-    RNG_XoShiRo256ss rng_xoshiro = rng_xoshiro256ss(time(NULL));
-    RNG* rng = (RNG*)&rng_xoshiro;
+    Gfx gfx = gfx_init("Minesweeper", pacing != PACING_UNCAPPED);
 
-    Difficulty difficulty = DIFFICULTY_EASY;
-    bool difficulty_changed = false;
+    if (endless) {
+        endless_run(&gfx, time(NULL));
+        gfx_deinit(&gfx);
+        return 0;
+    }
 
-    Board board = board_init(9, 9);
-    usize mines = 10;
-    bool board_generated = false;
+    Game game = custom
+        ? game_init(custom_w, custom_h, custom_mines, topology, time(NULL))
+        : game_init(0, 0, 0, topology, time(NULL));
+    game_start(&game);
+
+    // The render thread's copy of the game, brought up to date with
+    // the dirty area of every new snapshot. Rows not synced yet are
+    // taken from whichever snapshot is newest when they get their turn.
+    const GameSnapshot* snapshot = game_poll(&game);
+    Board board = board_init(snapshot->board.w, snapshot->board.h);
+    Lod lod = lod_init(board.w, board.h);
+    GameRect pending = snapshot->dirty;
+    // Sequence number of the last command whose result board shows
+    usize synced = 0;
+
+    LatencyProbe latency = latency_probe_init();
+    SDL_DisplayMode display_mode;
+    f64 frame_period_ms = 1000.0 / 60.0;
+    if (SDL_GetWindowDisplayMode(gfx.window, &display_mode) == 0 && display_mode.refresh_rate > 0) {
+        frame_period_ms = 1000.0 / display_mode.refresh_rate;
+    }
+    // Moving average of the time from handling input to presenting
+    f64 frame_work_ms = 0.0;
+    u64 last_present = SDL_GetPerformanceCounter();
+    // Sequence number of the last command sent to the game thread
+    usize sent = 0;
 
     bool run = true;
-    bool game_over = false;
-    bool victory = false;
     while (run) {
-        if (!board_generated && difficulty_changed) {
-            board_deinit(&board);
-            switch (difficulty) {
-            case DIFFICULTY_EASY:
-                board = board_init(9, 9);
-                mines = 10;
-                break;
-            case DIFFICULTY_MEDIUM:
-                board = board_init(16, 16);
-                mines = 40;
-                break;
-            case DIFFICULTY_HARD:
-                board = board_init(20, 20);
-                mines = 80;
-                break;
-            default:
-                unreachable();
-            }
-            difficulty_changed = false;
+        if (pacing == PACING_LATE_LATCH) {
+            // Leave some headroom, frame times vary
+            late_latch_wait(last_present, frame_period_ms, frame_work_ms * 1.5);
         }
+        u64 frame_start = SDL_GetPerformanceCounter();
 
         int render_w, render_h;
         SDL_GetRendererOutputSize(gfx.renderer, &render_w, &render_h);
 
-        f32 tile_size, tile_offset_x = 0.0, tile_offset_y = 0.0;
-        if (render_w < render_h) {
-            tile_size = (f32)render_w / (f32)board.w;
-            tile_offset_x = 0.0;
-            tile_offset_y = (render_h - render_w) / 2.0;
-        } else {
-            tile_size = (f32)render_h / (f32)board.h;
-            tile_offset_x = (render_w - render_h) / 2.0;
-            tile_offset_y = 0.0;
-        }
-
-        SDL_SetRenderDrawColor(gfx.renderer, 128, 128, 128, 255);
-        SDL_RenderClear(gfx.renderer);
+        f32 tile_size = min((f32)render_w / (f32)board.w, (f32)render_h / (f32)board.h);
+        f32 tile_offset_x = (render_w - board.w * tile_size) / 2.0;
+        f32 tile_offset_y = (render_h - board.h * tile_size) / 2.0;
 
         SDL_Event event;
         while (SDL_PollEvent(&event)) {
+            GameCommand command = { 0 };
             switch (event.type) {
             case SDL_QUIT:
                 run = false;
-                break;
+                continue;
             case SDL_KEYDOWN:
-                if (!board_generated) {
-                    if (event.key.keysym.sym == SDLK_RIGHT
-                        || event.key.keysym.sym == SDLK_DOWN) {
-                        difficulty = (difficulty + 1) % DIFFICULTIES_LEN;
-                    } else if (event.key.keysym.sym == SDLK_LEFT
-                        || event.key.keysym.sym == SDLK_UP) {
-                        difficulty = (difficulty + DIFFICULTIES_LEN - 1) % DIFFICULTIES_LEN;
-                    }
+                switch (event.key.keysym.sym) {
+                case SDLK_z:
+                    command.type = GAME_COMMAND_UNDO;
+                    break;
+                case SDLK_y:
+                    command.type = GAME_COMMAND_REDO;
+                    break;
+                case SDLK_RIGHT:
+                case SDLK_DOWN:
+                    command.type = GAME_COMMAND_DIFFICULTY;
+                    command.step = 1;
+                    break;
+                case SDLK_LEFT:
+                case SDLK_UP:
+                    command.type = GAME_COMMAND_DIFFICULTY;
+                    command.step = -1;
+                    break;
+                default:
+                    continue;
                 }
-                difficulty_changed = true;
                 break;
             case SDL_MOUSEBUTTONDOWN:
-                if (!game_over && !victory) {
-                    usize tile_x = (event.button.x - tile_offset_x) / tile_size;
-                    usize tile_y = (event.button.y - tile_offset_y) / tile_size;
-                    if (tile_x >= board.w || tile_y >= board.h) {
-                        break;
-                    }
-                    usize tile_index = tile_y * board.w + tile_x;
-                    switch (event.button.button) {
-                    case SDL_BUTTON_LEFT:
-                        if (!board.tiles[tile_index].flag) {
-                            if (!board_generated) {
-                                board_generate(&board, rng, mines, tile_x, tile_y);
-                                board_generated = true;
-                            }
-                            if (board.tiles[tile_index].mine) {
-                                game_over = true;
-                            } else {
-                                board_explore(&board, tile_x, tile_y);
-                            }
-                        }
-                        break;
-                    case SDL_BUTTON_RIGHT:
-                        if (!board.tiles[tile_index].open) {
-                            board.tiles[tile_index].flag = !board.tiles[tile_index].flag;
-                        }
-                        break;
-                    }
-                    break;
+                if (event.button.button != SDL_BUTTON_LEFT && event.button.button != SDL_BUTTON_RIGHT) {
+                    continue;
                 }
+                command.type = event.button.button == SDL_BUTTON_LEFT ? GAME_COMMAND_OPEN : GAME_COMMAND_FLAG;
+                command.x = (event.button.x - tile_offset_x) / tile_size;
+                command.y = (event.button.y - tile_offset_y) / tile_size;
+                if (command.x >= board.w || command.y >= board.h) {
+                    continue;
+                }
+                break;
+            default:
+                continue;
             }
+            usize seq = game_send(&game, command);
+            if (!seq) {
+                log_warn("game is not keeping up, dropped input");
+                continue;
+            }
+            latency_probe_input(&latency, event.common.timestamp, seq);
+            sent = seq;
         }
 
-        victory = true;
-        for (usize i = 0; i < board.w * board.h; i++) {
-            if (!board.tiles[i].open && !board.tiles[i].mine) {
-                victory = false;
-                break;
-            }
+        if (pacing == PACING_LATE_LATCH && snapshot->processed < sent) {
+            game_wait(&game, sent, LATE_LATCH_RESULT_MS);
+        }
+        const GameSnapshot* next = game_poll(&game);
+        if (next) {
+            game_rect_union(&pending, &next->dirty);
+            snapshot = next;
         }
+        if (game_sync(&board, &lod, &pending, snapshot)) {
+            synced = snapshot->processed;
+        }
+        // Keep the layout in sync with the board for drawing
+        tile_size = min((f32)render_w / (f32)board.w, (f32)render_h / (f32)board.h);
+        tile_offset_x = (render_w - board.w * tile_size) / 2.0;
+        tile_offset_y = (render_h - board.h * tile_size) / 2.0;
+        bool game_over = snapshot->game_over;
+        bool victory = snapshot->victory;
 
-        for (usize y = 0; y < board.h; y++) {
-            for (usize x = 0; x < board.w; x++) {
-                usize tile_index = y * board.w + x;
-                Texture texture = board.tiles[tile_index].open ? TEXTURE_TILE_OPEN : TEXTURE_TILE_CLOSED;
-                SDL_FRect dest = {
-                    tile_offset_x + x * tile_size,
-                    tile_offset_y + y * tile_size,
-                    tile_size,
-                    tile_size,
-                };
-                SDL_RenderCopyF(gfx.renderer, gfx.textures[texture],
-                    NULL,
-                    &dest);
-                if ((game_over || board.tiles[tile_index].open)
-                    && !board.tiles[tile_index].mine
-                    && !board.tiles[tile_index].flag
-                    && board.tiles[tile_index].nearby_mines > 0) {
-                    SDL_Rect src = {
-                        (board.tiles[tile_index].nearby_mines - 1) * 16,
-                        0,
-                        16,
-                        16,
+        SDL_SetRenderDrawColor(gfx.renderer, 128, 128, 128, 255);
+        SDL_RenderClear(gfx.renderer);
+
+        if (tile_size < LOD_TILE_SIZE) {
+            SDL_FRect dest = {
+                tile_offset_x,
+                tile_offset_y,
+                board.w * tile_size,
+                board.h * tile_size,
+            };
+            lod_draw(&lod, gfx.renderer, &dest, tile_size);
+        } else {
+            for (usize y = 0; y < board.h; y++) {
+                for (usize x = 0; x < board.w; x++) {
+                    SDL_FRect dest = {
+                        tile_offset_x + x * tile_size,
+                        tile_offset_y + y * tile_size,
+                        tile_size,
+                        tile_size,
                     };
-                    SDL_RenderCopyF(gfx.renderer, gfx.textures[TEXTURE_NUMBERS],
-                        &src,
-                        &dest);
-                }
-                if ((game_over || victory) && board.tiles[tile_index].mine) {
-                    Texture texture = board.tiles[tile_index].flag ? TEXTURE_MINE_FLAGGED : TEXTURE_MINE;
-                    SDL_RenderCopyF(gfx.renderer, gfx.textures[texture],
-                        NULL,
-                        &dest);
-                } else if (!board.tiles[tile_index].open && board.tiles[tile_index].flag) {
-                    SDL_RenderCopyF(gfx.renderer, gfx.textures[TEXTURE_FLAG],
-                        NULL,
-                        &dest);
+                    gfx_draw_tile(&gfx, &board.tiles[board_index(&board, x, y)], &dest, game_over, victory);
                 }
             }
         }
 
-        if (!board_generated) {
+        if (!snapshot->generated && !snapshot->custom) {
             SDL_FRect dest = {
                 tile_offset_x,
                 tile_offset_y,
@@ -401,7 +463,7 @@ int main(int argc, const char** argv)
             };
             SDL_Rect src = {
                 0,
-                difficulty * 128,
+                snapshot->difficulty * 128,
                 256,
                 128,
             };
@@ -409,7 +471,6 @@ int main(int argc, const char** argv)
                 &src,
                 &dest);
         }
-
         if (game_over || victory) {
             {
                 SDL_FRect dest = {
@@ -434,9 +495,20 @@ int main(int argc, const char** argv)
             }
         }
 
+        u64 present_start = SDL_GetPerformanceCounter();
+        frame_work_ms = frame_work_ms * 0.9 + (present_start - frame_start) * 1000.0 / SDL_GetPerformanceFrequency() * 0.1;
+
         SDL_RenderPresent(gfx.renderer);
+        last_present = SDL_GetPerformanceCounter();
+        latency_probe_present(&latency, synced);
     }
 
+    log_info("input latency with %s pacing:", pacing_names[pacing]);
+    latency_probe_print(&latency);
+    latency_probe_deinit(&latency);
+
+    game_deinit(&game);
+    lod_deinit(&lod);
     board_deinit(&board);
     gfx_deinit(&gfx);
 }
@@ -0,0 +1,120 @@
+#include "metrics.h"
+
+// Parent of tiles that aren't zero tiles
+#define METRICS_NONE (~(usize)0)
+
+Metrics metrics_init(void)
+{
+    return (Metrics) { 0 };
+}
+
+void metrics_deinit(const Metrics* self)
+{
+    free(self->parent);
+}
+
+static usize metrics_find(usize* parent, usize index)
+{
+    // Path halving
+    while (parent[index] != index) {
+        parent[index] = parent[parent[index]];
+        index = parent[index];
+    }
+    return index;
+}
+
+// Count the tiles with nearby mines in row y that have no zero neighbour.
+// All rows around y must have been visited.
+static usize metrics_isolated_row(const Board* board, const usize* parent, usize y)
+{
+    usize isolated = 0;
+    for (usize x = 0; x < board->w; x++) {
+        usize index = board_index(board, x, y);
+        const Tile* tile = &board->tiles[index];
+        if (tile->mine || tile->nearby_mines == 0) {
+            continue;
+        }
+        usize neighbours[8];
+        board_neighbours(board, index, neighbours);
+        bool next_to_zero = false;
+        for (usize i = 0; i < arrlen(neighbours); i++) {
+            next_to_zero |= parent[neighbours[i]] != METRICS_NONE;
+        }
+        isolated += !next_to_zero;
+    }
+    return isolated;
+}
+
+BoardMetrics metrics_compute(Metrics* self, const Board* board)
+{
+    usize tiles_len = board_tiles_len(board);
+    if (self->parent_cap < tiles_len) {
+        self->parent_cap = tiles_len;
+        free(self->parent);
+        if (!(self->parent = malloc(self->parent_cap * sizeof(usize)))) {
+            panic("Out of memory!");
+        }
+    }
+    usize* parent = self->parent;
+
+    // Padding tiles are never part of an opening
+    for (usize x = 0; x < board->stride; x++) {
+        parent[x] = METRICS_NONE;
+        parent[(board->h + 1) * board->stride + x] = METRICS_NONE;
+    }
+    for (usize y = 1; y <= board->h; y++) {
+        parent[y * board->stride] = METRICS_NONE;
+        parent[y * board->stride + board->w + 1] = METRICS_NONE;
+    }
+
+    usize zeros = 0;
+    usize merges = 0;
+    usize isolated = 0;
+    for (usize y = 0; y < board->h; y++) {
+        for (usize x = 0; x < board->w; x++) {
+            usize index = board_index(board, x, y);
+            const Tile* tile = &board->tiles[index];
+            if (tile->mine || tile->nearby_mines > 0) {
+                parent[index] = METRICS_NONE;
+                continue;
+            }
+            parent[index] = index;
+            zeros++;
+
+            // Join the zero neighbours visited so far. Every pair of
+            // neighbours is seen once, from the later of the two.
+            usize neighbours[8];
+            board_neighbours(board, index, neighbours);
+            for (usize i = 0; i < arrlen(neighbours); i++) {
+                usize neighbour = neighbours[i];
+                if (neighbour >= index || parent[neighbour] == METRICS_NONE) {
+                    continue;
+                }
+                usize a = metrics_find(parent, neighbour);
+                usize b = metrics_find(parent, index);
+                if (a != b) {
+                    parent[max(a, b)] = min(a, b);
+                    merges++;
+                }
+            }
+        }
+        // The row above now has all of its neighbours. The first row
+        // waits until the end, since it wraps to the last one on a torus.
+        if (y >= 2) {
+            isolated += metrics_isolated_row(board, parent, y - 1);
+        }
+    }
+    if (board->h >= 2) {
+        isolated += metrics_isolated_row(board, parent, board->h - 1);
+    }
+    if (board->h >= 1) {
+        isolated += metrics_isolated_row(board, parent, 0);
+    }
+
+    usize openings = zeros - merges;
+    return (BoardMetrics) {
+        .bbbv = openings + isolated,
+        .openings = openings,
+        .isolated = isolated,
+    };
+}
@@ -0,0 +1,35 @@
+#ifndef __METRICS_H__
+#define __METRICS_H__
+
+#include "main.h"
+#include "board.h"
+
+// Difficulty metrics of generated boards, computed in a single pass
+// over the tiles. Zero tiles (no mine, no nearby mines) are joined
+// into openings with a union-find as they are visited, and each row
+// is checked for isolated numbers once the rows around it are done.
+
+typedef struct {
+    // Minimum number of left clicks needed to clear the board,
+    // openings + isolated
+    usize bbbv;
+    // Connected areas of zero tiles, each cleared by a single click
+    usize openings;
+    // Tiles with nearby mines that aren't next to any zero tile,
+    // so they have to be clicked one by one
+    usize isolated;
+} BoardMetrics;
+
+// Scratch space, reused across boards
+typedef struct {
+    usize* parent; // union-find forest over tile indices, or METRICS_NONE
+    usize parent_cap;
+} Metrics;
+
+Metrics metrics_init(void);
+void metrics_deinit(const Metrics* self);
+// Compute the metrics of a board with mines and nearby mines
+// counted, regardless of which tiles are open or flagged
+BoardMetrics metrics_compute(Metrics* self, const Board* board);
+
+#endif // __METRICS_H__
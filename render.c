@@ -0,0 +1,282 @@
+#include "main.h"
+#include "board.h"
+#include "gfx.h"
+#include "rng.h"
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_image.h>
+#include <SDL2/SDL_surface.h>
+
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+// Headless batch renderer. Plays boards with random clicks and draws
+// every resulting frame with the same sprites and tile drawing as the
+// game, into offscreen surfaces through SDL's software renderer.
+
+typedef enum {
+    FORMAT_NONE, // only render, for measuring throughput
+    FORMAT_PPM,
+    FORMAT_PNG,
+} Format;
+
+typedef struct {
+    usize w;
+    usize h;
+    usize mines;
+    usize boards;
+    usize clicks; // random clicks after the first one, each rendered as a frame
+    usize tile_size; // in pixels
+    u64 seed;
+    const char* out_dir;
+    Format format;
+} RenderConfig;
+
+typedef struct {
+    const RenderConfig* config;
+    usize next_board; // shared, claimed atomically
+    usize frames; // shared, added atomically
+} RenderJob;
+
+typedef struct {
+    pthread_t thread;
+    RenderJob* job;
+} RenderWorker;
+
+static f64 now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static bool write_ppm(SDL_Surface* surface, const char* path)
+{
+    FILE* file = fopen(path, "wb");
+    if (!file) {
+        return false;
+    }
+    fprintf(file, "P6\n%d %d\n255\n", surface->w, surface->h);
+    u8* row = malloc(surface->w * 3);
+    if (!row) {
+        panic("Out of memory!");
+    }
+    for (int y = 0; y < surface->h; y++) {
+        // RGBA32 is laid out as R, G, B, A bytes in memory
+        const u8* pixels = (const u8*)surface->pixels + y * surface->pitch;
+        for (int x = 0; x < surface->w; x++) {
+            row[x * 3 + 0] = pixels[x * 4 + 0];
+            row[x * 3 + 1] = pixels[x * 4 + 1];
+            row[x * 3 + 2] = pixels[x * 4 + 2];
+        }
+        fwrite(row, 3, surface->w, file);
+    }
+    free(row);
+    return fclose(file) == 0;
+}
+
+static void render_frame(const Gfx* gfx, SDL_Surface* surface, const RenderConfig* config,
+    const Board* board, usize board_i, usize frame_i, bool game_over, bool victory)
+{
+    SDL_SetRenderDrawColor(gfx->renderer, 128, 128, 128, 255);
+    SDL_RenderClear(gfx->renderer);
+    for (usize y = 0; y < board->h; y++) {
+        for (usize x = 0; x < board->w; x++) {
+            SDL_FRect dest = {
+                x * config->tile_size,
+                y * config->tile_size,
+                config->tile_size,
+                config->tile_size,
+            };
+            gfx_draw_tile(gfx, &board->tiles[board_index(board, x, y)], &dest, game_over, victory);
+        }
+    }
+    // Draw calls are batched, make sure the surface is up to date
+    SDL_RenderFlush(gfx->renderer);
+
+    if (config->format == FORMAT_NONE) {
+        return;
+    }
+    char path[4096];
+    snprintf(path, sizeof(path), "%s/board_%06" PRIuPTR "_%04" PRIuPTR ".%s",
+        config->out_dir, board_i, frame_i, config->format == FORMAT_PNG ? "png" : "ppm");
+    bool written = config->format == FORMAT_PNG
+        ? IMG_SavePNG(surface, path) == 0
+        : write_ppm(surface, path);
+    if (!written) {
+        log_err("failed to write %s", path);
+    }
+}
+
+static bool board_won(const Board* board)
+{
+    for (usize i = 0; i < board_tiles_len(board); i++) {
+        if (!board->tiles[i].open && !board->tiles[i].mine) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void* render_worker_run(void* _self)
+{
+    RenderWorker* self = _self;
+    const RenderConfig* config = self->job->config;
+
+    SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormat(0,
+        config->w * config->tile_size, config->h * config->tile_size,
+        32, SDL_PIXELFORMAT_RGBA32);
+    if (!surface) {
+        panic("failed to create surface: %s", SDL_GetError());
+    }
+    Gfx gfx = gfx_init_surface(surface);
+    Board board = board_init(config->w, config->h);
+    usize cx = config->w / 2, cy = config->h / 2;
+
+    for (;;) {
+        usize board_i = __atomic_fetch_add(&self->job->next_board, 1, __ATOMIC_RELAXED);
+        if (board_i >= config->boards) {
+            break;
+        }
+        // Every board has its own seed, so the output does not
+        // depend on which thread renders it
+        RNG_XoShiRo256ss rng_xoshiro = rng_xoshiro256ss(config->seed + board_i);
+        RNG* rng = (RNG*)&rng_xoshiro;
+
+        board_clear(&board);
+        board_generate(&board, rng, config->mines, cx, cy);
+        board_explore(&board, cx, cy);
+        bool game_over = false;
+        bool victory = board_won(&board);
+        usize frame_i = 0;
+        render_frame(&gfx, surface, config, &board, board_i, frame_i++, game_over, victory);
+
+        for (usize c = 0; c < config->clicks && !game_over && !victory; c++) {
+            usize x, y;
+            do {
+                x = rng_u64_cap(rng, config->w);
+                y = rng_u64_cap(rng, config->h);
+            } while (board.tiles[board_index(&board, x, y)].open);
+            if (board.tiles[board_index(&board, x, y)].mine) {
+                board.tiles[board_index(&board, x, y)].open = true;
+                game_over = true;
+            } else {
+                board_explore(&board, x, y);
+                victory = board_won(&board);
+            }
+            render_frame(&gfx, surface, config, &board, board_i, frame_i++, game_over, victory);
+        }
+        __atomic_fetch_add(&self->job->frames, frame_i, __ATOMIC_RELAXED);
+    }
+
+    board_deinit(&board);
+    gfx_deinit(&gfx);
+    SDL_FreeSurface(surface);
+    return NULL;
+}
+
+static void print_usage(int argc, const char** argv)
+{
+    const char* progname = argc > 0 ? argv[0] : "minesweeper-render";
+    fprintf(stderr, "Usage:\n");
+    fprintf(stderr, "  %s [options]\n", progname);
+    fprintf(stderr, "Options:\n");
+    fprintf(stderr, "  -s <width>x<height> -- board size (default: 16x16)\n");
+    fprintf(stderr, "  -m <number>         -- number of mines (default: 40)\n");
+    fprintf(stderr, "  -n <number>         -- number of boards (default: 1000)\n");
+    fprintf(stderr, "  -c <number>         -- random clicks rendered per board (default: 0)\n");
+    fprintf(stderr, "  -z <pixels>         -- tile size (default: 16)\n");
+    fprintf(stderr, "  -r <seed>           -- seed (default: current time)\n");
+    fprintf(stderr, "  -t <number>         -- threads (default: number of CPUs)\n");
+    fprintf(stderr, "  -o <directory>      -- write frames to directory (default: none)\n");
+    fprintf(stderr, "  -f ppm|png          -- output format (default: ppm)\n");
+}
+
+int main(int argc, const char** argv)
+{
+    // Parse options
+    RenderConfig config = {
+        .w = 16,
+        .h = 16,
+        .mines = 40,
+        .boards = 1000,
+        .clicks = 0,
+        .tile_size = 16,
+        .seed = time(NULL),
+    };
+    usize n_threads = max(sysconf(_SC_NPROCESSORS_ONLN), 1);
+    bool png = false;
+    for (int i = 1; i < argc; i++) {
+        const char* param = i + 1 < argc ? argv[i + 1] : NULL;
+        bool valid = param != NULL;
+        if (strcmp(argv[i], "-s") == 0 && param) {
+            valid = sscanf(param, USIZE "x" USIZE, &config.w, &config.h) == 2
+                && config.w > 0 && config.h > 0;
+        } else if (strcmp(argv[i], "-m") == 0 && param) {
+            valid = sscanf(param, USIZE, &config.mines) == 1;
+        } else if (strcmp(argv[i], "-n") == 0 && param) {
+            valid = sscanf(param, USIZE, &config.boards) == 1;
+        } else if (strcmp(argv[i], "-c") == 0 && param) {
+            valid = sscanf(param, USIZE, &config.clicks) == 1;
+        } else if (strcmp(argv[i], "-z") == 0 && param) {
+            valid = sscanf(param, USIZE, &config.tile_size) == 1 && config.tile_size > 0;
+        } else if (strcmp(argv[i], "-r") == 0 && param) {
+            valid = sscanf(param, U64, &config.seed) == 1;
+        } else if (strcmp(argv[i], "-t") == 0 && param) {
+            valid = sscanf(param, USIZE, &n_threads) == 1 && n_threads > 0;
+        } else if (strcmp(argv[i], "-o") == 0 && param) {
+            config.out_dir = param;
+        } else if (strcmp(argv[i], "-f") == 0 && param) {
+            valid = strcmp(param, "ppm") == 0 || strcmp(param, "png") == 0;
+            png = strcmp(param, "png") == 0;
+        } else {
+            valid = false;
+        }
+        if (!valid) {
+            print_usage(argc, argv);
+            return 1;
+        }
+        i++;
+    }
+    // Leave the 3x3 area around the first click free
+    if (config.mines + 9 > config.w * config.h) {
+        log_err("too many mines for a " USIZE "x" USIZE " board", config.w, config.h);
+        return 1;
+    }
+    if (config.out_dir) {
+        config.format = png ? FORMAT_PNG : FORMAT_PPM;
+    }
+
+    RenderJob job = { .config = &config };
+    RenderWorker* workers = calloc(n_threads, sizeof(RenderWorker));
+    if (!workers) {
+        panic("Out of memory!");
+    }
+
+    // Workers load textures concurrently, so the PNG loader
+    // has to be initialized before any of them starts
+    if (!(IMG_Init(IMG_INIT_PNG) & IMG_INIT_PNG)) {
+        panic("failed to initialize SDL_image: %s", IMG_GetError());
+    }
+
+    f64 start = now();
+    for (usize i = 0; i < n_threads; i++) {
+        workers[i].job = &job;
+        if (pthread_create(&workers[i].thread, NULL, render_worker_run, &workers[i]) != 0) {
+            panic("failed to create render thread");
+        }
+    }
+    for (usize i = 0; i < n_threads; i++) {
+        pthread_join(workers[i].thread, NULL);
+    }
+    f64 elapsed = now() - start;
+    IMG_Quit();
+
+    log_info("rendered " USIZE " frames of " USIZE " boards with " USIZE " threads in %.3f s: %.1f frames/s",
+        job.frames, config.boards, n_threads, elapsed, job.frames / elapsed);
+
+    free(workers);
+    return 0;
+}
@@ -47,28 +47,23 @@ RNG_XoShiRo256ss rng_xoshiro256ss(u64 seed)
     return res;
 }
 
-void rng_xoshiro256ss_jump(RNG_XoShiRo256ss* self)
+// Calls xoshiro256ss_next directly instead of through the function
+// pointer, so the 256 steps of a jump can be inlined
+static void xoshiro256ss_jump(RNG_XoShiRo256ss* self, const u64 jump[4])
 {
-    static const u64 JUMP[] = {
-        0x180ec6d33cfd0aba,
-        0xd5a61266f0c9392c,
-        0xa9582618e03fc9aa,
-        0x39abdc4529b1661c,
-    };
-
     u64 s0 = 0;
     u64 s1 = 0;
     u64 s2 = 0;
     u64 s3 = 0;
-    for (usize i = 0; i < arrlen(JUMP); i++) {
+    for (usize i = 0; i < 4; i++) {
         for (usize b = 0; b < 64; b++) {
-            if (JUMP[i] & (u64)1 << b) {
+            if (jump[i] & (u64)1 << b) {
                 s0 ^= self->s[0];
                 s1 ^= self->s[1];
                 s2 ^= self->s[2];
                 s3 ^= self->s[3];
             }
-            rng_next((RNG*)self);
+            xoshiro256ss_next(self);
         }
     }
 
@@ -78,6 +73,51 @@ void rng_xoshiro256ss_jump(RNG_XoShiRo256ss* self)
     self->s[3] = s3;
 }
 
+void rng_xoshiro256ss_jump(RNG_XoShiRo256ss* self)
+{
+    static const u64 JUMP[] = {
+        0x180ec6d33cfd0aba,
+        0xd5a61266f0c9392c,
+        0xa9582618e03fc9aa,
+        0x39abdc4529b1661c,
+    };
+    xoshiro256ss_jump(self, JUMP);
+}
+
+void rng_xoshiro256ss_long_jump(RNG_XoShiRo256ss* self)
+{
+    static const u64 LONG_JUMP[] = {
+        0x76e15d3efefdcbbf,
+        0xc5004e441c522fb3,
+        0x77710069854ee241,
+        0x39109bb02acbe635,
+    };
+    xoshiro256ss_jump(self, LONG_JUMP);
+}
+
+RNGStreamPool rng_stream_pool_init(u64 seed, usize n_streams)
+{
+    RNGStreamPool self = {
+        .streams_len = n_streams,
+    };
+
+    if (!(self.streams = aligned_alloc(RNG_CACHE_LINE, max(n_streams, 1) * sizeof(RNGStream)))) {
+        panic("Out of memory!");
+    }
+    RNG_XoShiRo256ss rng = rng_xoshiro256ss(seed);
+    for (usize i = 0; i < n_streams; i++) {
+        self.streams[i].rng = rng;
+        rng_xoshiro256ss_long_jump(&rng);
+    }
+
+    return self;
+}
+
+void rng_stream_pool_deinit(const RNGStreamPool* self)
+{
+    free(self->streams);
+}
+
 u64 rng_u64(RNG* self)
 {
     return rng_next(self);
@@ -27,6 +27,36 @@ RNG_XoShiRo256ss rng_xoshiro256ss(u64 seed);
 // to 2^128 calls to next(); it can be used to generate 2^128
 // non-overlapping subsequences for parallel computations.
 void rng_xoshiro256ss_jump(RNG_XoShiRo256ss* self);
+// This is the long-jump function for the generator. It is equivalent to
+// 2^192 calls to next(); it can be used to generate 2^64 starting points,
+// from each of which jump() will generate 2^64 non-overlapping
+// subsequences for parallel distributed computations.
+void rng_xoshiro256ss_long_jump(RNG_XoShiRo256ss* self);
+
+#define RNG_CACHE_LINE 64
+
+// One generator per cache line, so threads using
+// neighbouring streams don't invalidate each other's
+typedef struct {
+    _Alignas(RNG_CACHE_LINE) RNG_XoShiRo256ss rng;
+} RNGStream;
+
+// Independent generators for parallel computations, derived from a
+// single seed. Stream i starts i long jumps after the seed, so it is
+// the same regardless of the number of streams, and every stream
+// can still be split further with rng_xoshiro256ss_jump.
+typedef struct {
+    RNGStream* streams;
+    usize streams_len;
+} RNGStreamPool;
+
+RNGStreamPool rng_stream_pool_init(u64 seed, usize n_streams);
+void rng_stream_pool_deinit(const RNGStreamPool* self);
+
+static inline RNG* rng_stream_pool_get(RNGStreamPool* self, usize i)
+{
+    return (RNG*)&self->streams[i].rng;
+}
 
 // Generate next pseudorandom number
 u64 rng_next(RNG* self);
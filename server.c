@@ -0,0 +1,795 @@
+#define _GNU_SOURCE // accept4
+
+#include "main.h"
+#include "board.h"
+#include "rng.h"
+#include "server.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+// Session ids carry the pool slot in the lower bits and the slot's
+// generation in the upper bits, so ids of ended sessions become invalid
+#define SESSION_INDEX_BITS 20
+#define SESSION_INDEX_MASK (((u32)1 << SESSION_INDEX_BITS) - 1)
+
+#define SERVER_DEFAULT_MAX_SESSIONS 65536
+// Tiles over all sessions, including buffers kept by ended sessions
+#define SERVER_DEFAULT_MAX_TOTAL_TILES ((usize)1 << 26)
+#define SERVER_MAX_EVENTS 256
+#define SERVER_READ_SIZE 4096
+// Requests of a connection are only read and handled while less than
+// this much of its output is waiting to be sent, so a client that
+// doesn't read its responses can't make the server buffer without bound
+#define SERVER_OUT_MAX ((usize)1 << 20)
+
+typedef struct {
+    u8* data;
+    usize len;
+    usize cap;
+    usize pos; // bytes already consumed or sent
+} Buffer;
+
+typedef struct Conn Conn;
+
+struct Conn {
+    int fd;
+    Buffer in;
+    Buffer out;
+    // Sessions created by this connection, ended when it closes
+    u32* sessions;
+    usize sessions_len;
+    usize sessions_cap;
+    // Live connections, closed by the server when it shuts down
+    Conn* prev;
+    Conn* next;
+};
+
+typedef struct {
+    Board board;
+    usize tiles_cap; // kept when the slot is returned to the pool
+    usize mines;
+    usize closed_safe; // safe tiles that are still closed
+    u64 seed;
+    // Checked by session_get on any worker, so only accessed atomically
+    u32 generation;
+    bool used;
+    const Conn* owner;
+    bool generated;
+    bool over;
+    usize next_free;
+} Session;
+
+// Fixed pool of session slots. Tile buffers stay with their slot
+// after a session ends and are reused by the next session that fits,
+// until they're needed to keep all buffers under max_tiles.
+typedef struct {
+    pthread_mutex_t lock;
+    Session* sessions;
+    usize len;
+    usize free;
+    usize tiles; // tiles of all buffers, kept ones included
+    usize tiles_used; // tiles of the buffers of live sessions
+    usize max_tiles;
+} SessionPool;
+
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    Conn** items;
+    usize head;
+    usize len;
+    usize cap;
+} ConnQueue;
+
+typedef struct Server Server;
+
+typedef struct {
+    Server* server;
+    BoardExplorer explorer;
+    RNG* rng; // for seeds picked by the server
+    pthread_t thread;
+} Worker;
+
+struct Server {
+    int epoll_fd;
+    int listen_fd;
+    SessionPool pool;
+    ConnQueue queue;
+    pthread_mutex_t conns_lock;
+    Conn* conns;
+    Worker* workers;
+    usize workers_len;
+    RNGStreamPool rngs; // one stream per worker
+};
+
+static volatile sig_atomic_t running = 1;
+
+static void handle_signal(int sig)
+{
+    (void)sig;
+    running = 0;
+}
+
+static void buffer_reserve(Buffer* self, usize len)
+{
+    if (self->len + len <= self->cap) {
+        return;
+    }
+    // Drop consumed bytes before growing
+    if (self->pos > 0) {
+        memmove(self->data, self->data + self->pos, self->len - self->pos);
+        self->len -= self->pos;
+        self->pos = 0;
+    }
+    if (self->len + len > self->cap) {
+        self->cap = max(self->cap * 2, self->len + len);
+        if (!(self->data = realloc(self->data, self->cap))) {
+            panic("Out of memory!");
+        }
+    }
+}
+
+static SessionPool session_pool_init(usize len, usize max_tiles)
+{
+    SessionPool self = {
+        .len = len,
+        .free = 0,
+        .max_tiles = max_tiles,
+    };
+    pthread_mutex_init(&self.lock, NULL);
+    if (!(self.sessions = calloc(len, sizeof(Session)))) {
+        panic("Out of memory!");
+    }
+    for (usize i = 0; i < len; i++) {
+        self.sessions[i].next_free = i + 1 < len ? i + 1 : ~(usize)0;
+    }
+    return self;
+}
+
+static void session_pool_deinit(SessionPool* self)
+{
+    for (usize i = 0; i < self->len; i++) {
+        free(self->sessions[i].board.tiles);
+    }
+    free(self->sessions);
+    pthread_mutex_destroy(&self->lock);
+}
+
+// Free the buffers kept by ended sessions until tiles more fit under
+// the limit. Must be called with the lock held.
+static void session_pool_reclaim(SessionPool* self, usize tiles)
+{
+    for (usize i = self->free; i != ~(usize)0 && self->tiles + tiles > self->max_tiles; i = self->sessions[i].next_free) {
+        Session* session = &self->sessions[i];
+        free(session->board.tiles);
+        session->board.tiles = NULL;
+        self->tiles -= session->tiles_cap;
+        session->tiles_cap = 0;
+    }
+}
+
+// Returns the new session's id, or 0 with *ok set to false if the
+// pool is exhausted or the board would go past the tile limit
+static u32 session_acquire(SessionPool* self, const Conn* owner, usize w, usize h, usize mines, u64 seed, bool* ok)
+{
+    usize tiles_len = BOARD_TILES_LEN(w, h);
+    pthread_mutex_lock(&self->lock);
+    usize index = self->free;
+    if (index == ~(usize)0 || self->tiles_used + tiles_len > self->max_tiles) {
+        pthread_mutex_unlock(&self->lock);
+        *ok = false;
+        return 0;
+    }
+    Session* session = &self->sessions[index];
+    self->free = session->next_free;
+    // The buffer is replaced below, outside the lock
+    Tile* old_tiles = NULL;
+    if (session->tiles_cap < tiles_len) {
+        old_tiles = session->board.tiles;
+        session->board.tiles = NULL;
+        self->tiles -= session->tiles_cap;
+        session_pool_reclaim(self, tiles_len);
+        self->tiles += tiles_len;
+        session->tiles_cap = tiles_len;
+    }
+    self->tiles_used += session->tiles_cap;
+    pthread_mutex_unlock(&self->lock);
+
+    if (!session->board.tiles) {
+        free(old_tiles);
+        if (!(session->board.tiles = malloc(session->tiles_cap * sizeof(Tile)))) {
+            panic("Out of memory!");
+        }
+    }
+    session->board = board_init_buffer(session->board.tiles, w, h, BOARD_TOPOLOGY_BOUNDED);
+    session->mines = mines;
+    session->closed_safe = w * h - mines;
+    session->seed = seed;
+    session->generated = false;
+    session->over = false;
+    __atomic_store_n(&session->owner, owner, __ATOMIC_RELAXED);
+    // Publishes the fields above to the owner's next worker
+    __atomic_store_n(&session->used, true, __ATOMIC_RELEASE);
+
+    *ok = true;
+    return __atomic_load_n(&session->generation, __ATOMIC_RELAXED) << SESSION_INDEX_BITS | index;
+}
+
+static Session* session_get(SessionPool* self, const Conn* owner, u32 id)
+{
+    usize index = id & SESSION_INDEX_MASK;
+    if (index >= self->len) {
+        return NULL;
+    }
+    // Any connection can send any id, so the check races with other
+    // workers acquiring and releasing the slot and has to be atomic.
+    // Past the check only the owning connection accesses the session,
+    // and a connection is only ever handled by one worker at a time.
+    Session* session = &self->sessions[index];
+    if (!__atomic_load_n(&session->used, __ATOMIC_ACQUIRE)
+        || __atomic_load_n(&session->owner, __ATOMIC_RELAXED) != owner
+        || __atomic_load_n(&session->generation, __ATOMIC_RELAXED) != id >> SESSION_INDEX_BITS) {
+        return NULL;
+    }
+    return session;
+}
+
+static void session_release(SessionPool* self, Session* session)
+{
+    u32 generation = __atomic_load_n(&session->generation, __ATOMIC_RELAXED);
+    __atomic_store_n(&session->used, false, __ATOMIC_RELAXED);
+    __atomic_store_n(&session->owner, NULL, __ATOMIC_RELAXED);
+    __atomic_store_n(&session->generation, (generation + 1) & (~(u32)0 >> SESSION_INDEX_BITS), __ATOMIC_RELAXED);
+
+    pthread_mutex_lock(&self->lock);
+    session->next_free = self->free;
+    self->free = session - self->sessions;
+    self->tiles_used -= session->tiles_cap;
+    pthread_mutex_unlock(&self->lock);
+}
+
+static void conn_queue_push(ConnQueue* self, Conn* conn)
+{
+    pthread_mutex_lock(&self->lock);
+    if (self->len == self->cap) {
+        usize old_cap = self->cap;
+        self->cap = max(self->cap * 2, 64);
+        if (!(self->items = realloc(self->items, self->cap * sizeof(Conn*)))) {
+            panic("Out of memory!");
+        }
+        if (self->head + self->len > old_cap) {
+            memcpy(self->items + old_cap, self->items, (self->head + self->len - old_cap) * sizeof(Conn*));
+        }
+    }
+    self->items[(self->head + self->len) % self->cap] = conn;
+    self->len++;
+    pthread_cond_signal(&self->cond);
+    pthread_mutex_unlock(&self->lock);
+}
+
+static Conn* conn_queue_pop(ConnQueue* self)
+{
+    pthread_mutex_lock(&self->lock);
+    while (self->len == 0) {
+        pthread_cond_wait(&self->cond, &self->lock);
+    }
+    Conn* conn = self->items[self->head];
+    self->head = (self->head + 1) % self->cap;
+    self->len--;
+    pthread_mutex_unlock(&self->lock);
+    return conn;
+}
+
+static u8* conn_respond(Conn* self, u8 type, ResponseStatus status, usize payload_len)
+{
+    buffer_reserve(&self->out, RESPONSE_HEADER_SIZE + payload_len);
+    u8* header = self->out.data + self->out.len;
+    header[0] = type;
+    header[1] = status;
+    put_u32(header + 2, payload_len);
+    self->out.len += RESPONSE_HEADER_SIZE + payload_len;
+    return header + RESPONSE_HEADER_SIZE;
+}
+
+static void handle_new_game(Worker* worker, Conn* conn, const u8* body)
+{
+    Server* server = worker->server;
+    usize w = get_u16(body);
+    usize h = get_u16(body + 2);
+    usize mines = get_u32(body + 4);
+    u64 seed = get_u64(body + 8);
+    if (seed == 0) {
+        seed = rng_u64(worker->rng);
+    }
+
+    if (w == 0 || h == 0 || w * h > SERVER_MAX_TILES || mines + 9 > w * h) {
+        conn_respond(conn, REQUEST_NEW_GAME, RESPONSE_ERROR, 0);
+        return;
+    }
+
+    bool ok;
+    u32 id = session_acquire(&server->pool, conn, w, h, mines, seed, &ok);
+    if (!ok) {
+        conn_respond(conn, REQUEST_NEW_GAME, RESPONSE_ERROR, 0);
+        return;
+    }
+
+    if (conn->sessions_len == conn->sessions_cap) {
+        conn->sessions_cap = max(conn->sessions_cap * 2, 4);
+        if (!(conn->sessions = realloc(conn->sessions, conn->sessions_cap * sizeof(u32)))) {
+            panic("Out of memory!");
+        }
+    }
+    conn->sessions[conn->sessions_len++] = id;
+
+    put_u32(conn_respond(conn, REQUEST_NEW_GAME, RESPONSE_OK, 4), id);
+}
+
+static void handle_open(Worker* worker, Conn* conn, const u8* body)
+{
+    Session* session = session_get(&worker->server->pool, conn, get_u32(body));
+    usize x = get_u16(body + 4);
+    usize y = get_u16(body + 6);
+
+    if (!session || session->over || x >= session->board.w || y >= session->board.h) {
+        conn_respond(conn, REQUEST_OPEN, RESPONSE_ERROR, 0);
+        return;
+    }
+    Board* board = &session->board;
+    Tile* tile = &board->tiles[board_index(board, x, y)];
+
+    if (!session->generated) {
+        RNG_XoShiRo256ss rng_xoshiro = rng_xoshiro256ss(session->seed);
+        board_generate(board, (RNG*)&rng_xoshiro, session->mines, x, y);
+        session->generated = true;
+    }
+
+    if (tile->flag) {
+        put_u32(conn_respond(conn, REQUEST_OPEN, RESPONSE_OK, 4), 0);
+        return;
+    }
+    if (tile->mine) {
+        session->over = true;
+        put_u32(conn_respond(conn, REQUEST_OPEN, RESPONSE_LOST, 4), 0);
+        return;
+    }
+
+    // Send only what this request opened
+    BoardExplorer* explorer = &worker->explorer;
+    explorer->opened_len = 0;
+    board_explorer_start(explorer, board, x, y);
+    board_explorer_step(explorer, board, ~(usize)0);
+
+    session->closed_safe -= explorer->opened_len;
+    ResponseStatus status = RESPONSE_OK;
+    if (session->closed_safe == 0) {
+        session->over = true;
+        status = RESPONSE_WON;
+    }
+
+    u8* payload = conn_respond(conn, REQUEST_OPEN, status, 4 + explorer->opened_len * RESPONSE_OPENED_TILE_SIZE);
+    put_u32(payload, explorer->opened_len);
+    payload += 4;
+    for (usize i = 0; i < explorer->opened_len; i++) {
+        usize index = explorer->opened[i];
+        put_u16(payload, board_x(board, index));
+        put_u16(payload + 2, board_y(board, index));
+        payload[4] = board->tiles[index].nearby_mines;
+        payload += RESPONSE_OPENED_TILE_SIZE;
+    }
+}
+
+static void handle_flag(Server* server, Conn* conn, const u8* body)
+{
+    Session* session = session_get(&server->pool, conn, get_u32(body));
+    usize x = get_u16(body + 4);
+    usize y = get_u16(body + 6);
+
+    if (!session || session->over || x >= session->board.w || y >= session->board.h) {
+        conn_respond(conn, REQUEST_FLAG, RESPONSE_ERROR, 0);
+        return;
+    }
+
+    Tile* tile = &session->board.tiles[board_index(&session->board, x, y)];
+    if (!tile->open) {
+        tile->flag = !tile->flag;
+    }
+    conn_respond(conn, REQUEST_FLAG, RESPONSE_OK, 0);
+}
+
+static void handle_query(Server* server, Conn* conn, const u8* body)
+{
+    Session* session = session_get(&server->pool, conn, get_u32(body));
+    usize x = get_u16(body + 4);
+    usize y = get_u16(body + 6);
+    usize w = get_u16(body + 8);
+    usize h = get_u16(body + 10);
+
+    if (!session || x + w > session->board.w || y + h > session->board.h || w * h > SERVER_MAX_QUERY_TILES) {
+        conn_respond(conn, REQUEST_QUERY, RESPONSE_ERROR, 0);
+        return;
+    }
+
+    u8* payload = conn_respond(conn, REQUEST_QUERY, RESPONSE_OK, w * h);
+    for (usize ty = y; ty < y + h; ty++) {
+        for (usize tx = x; tx < x + w; tx++) {
+            const Tile* tile = &session->board.tiles[board_index(&session->board, tx, ty)];
+            *payload++ = tile->open ? tile->nearby_mines : tile->flag ? TILE_FLAGGED : TILE_CLOSED;
+        }
+    }
+}
+
+static void handle_end(Server* server, Conn* conn, const u8* body)
+{
+    u32 id = get_u32(body);
+    Session* session = session_get(&server->pool, conn, id);
+    if (!session) {
+        conn_respond(conn, REQUEST_END, RESPONSE_ERROR, 0);
+        return;
+    }
+
+    session_release(&server->pool, session);
+    for (usize i = 0; i < conn->sessions_len; i++) {
+        if (conn->sessions[i] == id) {
+            conn->sessions[i] = conn->sessions[--conn->sessions_len];
+            break;
+        }
+    }
+    conn_respond(conn, REQUEST_END, RESPONSE_OK, 0);
+}
+
+static usize conn_pending(const Conn* self)
+{
+    return self->out.len - self->out.pos;
+}
+
+// Returns false if the connection sent garbage
+static bool conn_process(Worker* worker, Conn* conn)
+{
+    Buffer* in = &conn->in;
+    while (in->len > in->pos && conn_pending(conn) < SERVER_OUT_MAX) {
+        u8 type = in->data[in->pos];
+        if (type >= REQUESTS_LEN) {
+            return false;
+        }
+        if (in->len - in->pos < 1 + request_body_size[type]) {
+            break;
+        }
+        const u8* body = in->data + in->pos + 1;
+        switch (type) {
+        case REQUEST_NEW_GAME:
+            handle_new_game(worker, conn, body);
+            break;
+        case REQUEST_OPEN:
+            handle_open(worker, conn, body);
+            break;
+        case REQUEST_FLAG:
+            handle_flag(worker->server, conn, body);
+            break;
+        case REQUEST_QUERY:
+            handle_query(worker->server, conn, body);
+            break;
+        case REQUEST_END:
+            handle_end(worker->server, conn, body);
+            break;
+        default:
+            unreachable();
+        }
+        in->pos += 1 + request_body_size[type];
+    }
+    if (in->pos == in->len) {
+        in->pos = 0;
+        in->len = 0;
+    }
+    return true;
+}
+
+static void conn_close(Server* server, Conn* conn)
+{
+    for (usize i = 0; i < conn->sessions_len; i++) {
+        Session* session = session_get(&server->pool, conn, conn->sessions[i]);
+        if (session) {
+            session_release(&server->pool, session);
+        }
+    }
+    epoll_ctl(server->epoll_fd, EPOLL_CTL_DEL, conn->fd, NULL);
+    close(conn->fd);
+
+    pthread_mutex_lock(&server->conns_lock);
+    if (conn->prev) {
+        conn->prev->next = conn->next;
+    } else {
+        server->conns = conn->next;
+    }
+    if (conn->next) {
+        conn->next->prev = conn->prev;
+    }
+    pthread_mutex_unlock(&server->conns_lock);
+
+    free(conn->in.data);
+    free(conn->out.data);
+    free(conn->sessions);
+    free(conn);
+}
+
+// Send as much output as the socket takes, returns false on errors
+static bool conn_flush(Conn* self)
+{
+    Buffer* out = &self->out;
+    while (out->pos < out->len) {
+        isize n = send(self->fd, out->data + out->pos, out->len - out->pos, MSG_NOSIGNAL);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                break;
+            }
+            return false;
+        }
+        out->pos += n;
+    }
+    if (out->pos == out->len) {
+        out->pos = 0;
+        out->len = 0;
+    }
+    return true;
+}
+
+// Handle a connection that epoll reported as ready. Connections are
+// registered with EPOLLONESHOT, so only one worker sees a connection
+// at a time until it is re-armed at the end.
+static void conn_handle(Worker* worker, Conn* conn)
+{
+    Server* server = worker->server;
+
+    for (;;) {
+        // Handle buffered requests, including any left over from
+        // last time. Handling stops early while the output is full.
+        if (!conn_process(worker, conn)) {
+            conn_close(server, conn);
+            return;
+        }
+        bool stalled = conn_pending(conn) >= SERVER_OUT_MAX;
+        if (!conn_flush(conn)) {
+            conn_close(server, conn);
+            return;
+        }
+        if (stalled) {
+            // Wait for the client to read before reading any more
+            if (conn_pending(conn) >= SERVER_OUT_MAX) {
+                break;
+            }
+            continue;
+        }
+
+        buffer_reserve(&conn->in, SERVER_READ_SIZE);
+        isize n = read(conn->fd, conn->in.data + conn->in.len, conn->in.cap - conn->in.len);
+        if (n > 0) {
+            conn->in.len += n;
+            continue;
+        }
+        if (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+            conn_close(server, conn);
+            return;
+        }
+        if (errno != EINTR) {
+            break;
+        }
+    }
+
+    // Stop listening for requests until the client has read enough
+    struct epoll_event event = {
+        .events = EPOLLONESHOT
+            | (conn_pending(conn) < SERVER_OUT_MAX ? EPOLLIN : 0)
+            | (conn_pending(conn) > 0 ? EPOLLOUT : 0),
+        .data.ptr = conn,
+    };
+    if (epoll_ctl(server->epoll_fd, EPOLL_CTL_MOD, conn->fd, &event) < 0) {
+        conn_close(server, conn);
+    }
+}
+
+static void* worker_run(void* _self)
+{
+    Worker* self = _self;
+    Conn* conn;
+    // A NULL connection tells the worker to stop
+    while ((conn = conn_queue_pop(&self->server->queue))) {
+        conn_handle(self, conn);
+    }
+    return NULL;
+}
+
+static void server_accept(Server* self)
+{
+    for (;;) {
+        int fd = accept4(self->listen_fd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) {
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                log_warn("failed to accept connection: %s", strerror(errno));
+            }
+            return;
+        }
+
+        Conn* conn;
+        if (!(conn = calloc(1, sizeof(Conn)))) {
+            panic("Out of memory!");
+        }
+        conn->fd = fd;
+
+        // Linked before registering, a worker may close it right after
+        pthread_mutex_lock(&self->conns_lock);
+        conn->next = self->conns;
+        if (self->conns) {
+            self->conns->prev = conn;
+        }
+        self->conns = conn;
+        pthread_mutex_unlock(&self->conns_lock);
+
+        struct epoll_event event = {
+            .events = EPOLLIN | EPOLLONESHOT,
+            .data.ptr = conn,
+        };
+        if (epoll_ctl(self->epoll_fd, EPOLL_CTL_ADD, fd, &event) < 0) {
+            log_warn("failed to register connection: %s", strerror(errno));
+            conn_close(self, conn);
+        }
+    }
+}
+
+static void print_usage(int argc, const char** argv)
+{
+    const char* progname = argc > 0 ? argv[0] : "minesweeper-server";
+    fprintf(stderr, "Usage:\n");
+    fprintf(stderr, "  %s [options]\n", progname);
+    fprintf(stderr, "Options:\n");
+    fprintf(stderr, "  -s <path>   -- socket path (default: \"%s\")\n", SERVER_DEFAULT_SOCKET);
+    fprintf(stderr, "  -t <number> -- worker threads (default: number of CPUs)\n");
+    fprintf(stderr, "  -n <number> -- maximum concurrent sessions (default: %d)\n", SERVER_DEFAULT_MAX_SESSIONS);
+    fprintf(stderr, "  -m <number> -- maximum tiles over all sessions (default: " USIZE ")\n", SERVER_DEFAULT_MAX_TOTAL_TILES);
+    fprintf(stderr, "  -r <seed>   -- seed for games started with seed 0 (default: current time)\n");
+}
+
+int main(int argc, const char** argv)
+{
+    // Parse options
+    const char* socket_path = SERVER_DEFAULT_SOCKET;
+    usize n_threads = max(sysconf(_SC_NPROCESSORS_ONLN), 1);
+    usize max_sessions = SERVER_DEFAULT_MAX_SESSIONS;
+    usize max_tiles = SERVER_DEFAULT_MAX_TOTAL_TILES;
+    u64 seed = time(NULL);
+    for (int i = 1; i < argc; i++) {
+        const char* param = i + 1 < argc ? argv[i + 1] : NULL;
+        bool valid = param != NULL;
+        if (strcmp(argv[i], "-s") == 0 && param) {
+            socket_path = param;
+        } else if (strcmp(argv[i], "-t") == 0 && param) {
+            valid = sscanf(param, USIZE, &n_threads) == 1 && n_threads > 0;
+        } else if (strcmp(argv[i], "-r") == 0 && param) {
+            valid = sscanf(param, U64, &seed) == 1;
+        } else if (strcmp(argv[i], "-n") == 0 && param) {
+            valid = sscanf(param, USIZE, &max_sessions) == 1
+                && max_sessions > 0 && max_sessions <= SESSION_INDEX_MASK + 1;
+        } else if (strcmp(argv[i], "-m") == 0 && param) {
+            valid = sscanf(param, USIZE, &max_tiles) == 1 && max_tiles > 0;
+        } else {
+            valid = false;
+        }
+        if (!valid) {
+            print_usage(argc, argv);
+            return 1;
+        }
+        i++;
+    }
+
+    struct sigaction action = { .sa_handler = handle_signal };
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+
+    Server server = {
+        .pool = session_pool_init(max_sessions, max_tiles),
+        .workers_len = n_threads,
+        .rngs = rng_stream_pool_init(seed, n_threads),
+    };
+    pthread_mutex_init(&server.queue.lock, NULL);
+    pthread_cond_init(&server.queue.cond, NULL);
+    pthread_mutex_init(&server.conns_lock, NULL);
+
+    struct sockaddr_un addr = { .sun_family = AF_UNIX };
+    if (strlen(socket_path) >= sizeof(addr.sun_path)) {
+        log_err("socket path too long: %s", socket_path);
+        return 1;
+    }
+    strcpy(addr.sun_path, socket_path);
+    unlink(socket_path);
+
+    server.listen_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (server.listen_fd < 0
+        || bind(server.listen_fd, (struct sockaddr*)&addr, sizeof(addr)) < 0
+        || listen(server.listen_fd, SOMAXCONN) < 0) {
+        log_err("failed to listen on %s: %s", socket_path, strerror(errno));
+        return 1;
+    }
+
+    if ((server.epoll_fd = epoll_create1(EPOLL_CLOEXEC)) < 0) {
+        panic("failed to create epoll instance: %s", strerror(errno));
+    }
+    struct epoll_event listen_event = {
+        .events = EPOLLIN,
+        .data.ptr = NULL,
+    };
+    if (epoll_ctl(server.epoll_fd, EPOLL_CTL_ADD, server.listen_fd, &listen_event) < 0) {
+        panic("failed to register listening socket: %s", strerror(errno));
+    }
+
+    if (!(server.workers = calloc(n_threads, sizeof(Worker)))) {
+        panic("Out of memory!");
+    }
+    for (usize i = 0; i < n_threads; i++) {
+        server.workers[i].server = &server;
+        server.workers[i].explorer = board_explorer_init();
+        server.workers[i].rng = rng_stream_pool_get(&server.rngs, i);
+        if (pthread_create(&server.workers[i].thread, NULL, worker_run, &server.workers[i]) != 0) {
+            panic("failed to create worker thread");
+        }
+    }
+
+    log_info("listening on %s with " USIZE " workers", socket_path, n_threads);
+
+    while (running) {
+        struct epoll_event events[SERVER_MAX_EVENTS];
+        int n = epoll_wait(server.epoll_fd, events, arrlen(events), -1);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            panic("epoll_wait failed: %s", strerror(errno));
+        }
+        for (int i = 0; i < n; i++) {
+            if (events[i].data.ptr) {
+                conn_queue_push(&server.queue, events[i].data.ptr);
+            } else {
+                server_accept(&server);
+            }
+        }
+    }
+
+    log_info("shutting down");
+
+    for (usize i = 0; i < n_threads; i++) {
+        conn_queue_push(&server.queue, NULL);
+    }
+    for (usize i = 0; i < n_threads; i++) {
+        pthread_join(server.workers[i].thread, NULL);
+        board_explorer_deinit(&server.workers[i].explorer);
+    }
+    free(server.workers);
+    rng_stream_pool_deinit(&server.rngs);
+
+    // The workers are gone, so whatever is still linked is idle in epoll
+    while (server.conns) {
+        conn_close(&server, server.conns);
+    }
+    pthread_mutex_destroy(&server.conns_lock);
+
+    close(server.listen_fd);
+    close(server.epoll_fd);
+    unlink(socket_path);
+
+    free(server.queue.items);
+    pthread_cond_destroy(&server.queue.cond);
+    pthread_mutex_destroy(&server.queue.lock);
+    session_pool_deinit(&server.pool);
+
+    return 0;
+}
@@ -0,0 +1,94 @@
+#ifndef __SERVER_H__
+#define __SERVER_H__
+
+#include "main.h"
+
+// Binary protocol of the headless game server
+//
+// Every request is a type byte followed by a fixed size body, every
+// response is a header (echoed type byte, status byte, u32 payload
+// length) followed by the payload. All integers are little endian.
+//
+// Request bodies and response payloads:
+// - NEW_GAME: u16 w, u16 h, u32 mines, u64 seed -> u32 session
+// - OPEN:     u32 session, u16 x, u16 y -> u32 n, n * (u16 x, u16 y, u8 nearby mines)
+//             (only the tiles opened by this request)
+// - FLAG:     u32 session, u16 x, u16 y -> (empty)
+// - QUERY:    u32 session, u16 x, u16 y, u16 w, u16 h -> w * h tile bytes
+//             (0-8: open with n nearby mines, TILE_CLOSED, TILE_FLAGGED)
+// - END:      u32 session -> (empty)
+//
+// The board is generated on the first OPEN, keeping the 3x3 area
+// around the opened tile free of mines. A NEW_GAME seed of 0 lets
+// the server pick one.
+
+#define SERVER_DEFAULT_SOCKET "/tmp/minesweeper.sock"
+// Largest board a session may create
+#define SERVER_MAX_TILES ((usize)1 << 22)
+// Largest area a single QUERY may cover
+#define SERVER_MAX_QUERY_TILES ((usize)1 << 16)
+
+typedef enum {
+    REQUEST_NEW_GAME,
+    REQUEST_OPEN,
+    REQUEST_FLAG,
+    REQUEST_QUERY,
+    REQUEST_END,
+    REQUESTS_LEN,
+} RequestType;
+
+static const usize request_body_size[REQUESTS_LEN] = {
+    [REQUEST_NEW_GAME] = 16,
+    [REQUEST_OPEN] = 8,
+    [REQUEST_FLAG] = 8,
+    [REQUEST_QUERY] = 12,
+    [REQUEST_END] = 4,
+};
+
+typedef enum {
+    RESPONSE_OK,
+    RESPONSE_WON, // the request opened the last safe tile
+    RESPONSE_LOST, // the request opened a mine
+    RESPONSE_ERROR, // invalid request or session
+} ResponseStatus;
+
+#define RESPONSE_HEADER_SIZE 6
+#define RESPONSE_OPENED_TILE_SIZE 5
+
+#define TILE_CLOSED 9
+#define TILE_FLAGGED 10
+
+static inline void put_u16(u8* buf, u16 x)
+{
+    buf[0] = x;
+    buf[1] = x >> 8;
+}
+
+static inline void put_u32(u8* buf, u32 x)
+{
+    put_u16(buf, x);
+    put_u16(buf + 2, x >> 16);
+}
+
+static inline void put_u64(u8* buf, u64 x)
+{
+    put_u32(buf, x);
+    put_u32(buf + 4, x >> 32);
+}
+
+static inline u16 get_u16(const u8* buf)
+{
+    return (u16)buf[0] | (u16)buf[1] << 8;
+}
+
+static inline u32 get_u32(const u8* buf)
+{
+    return (u32)get_u16(buf) | (u32)get_u16(buf + 2) << 16;
+}
+
+static inline u64 get_u64(const u8* buf)
+{
+    return (u64)get_u32(buf) | (u64)get_u32(buf + 4) << 32;
+}
+
+#endif // __SERVER_H__
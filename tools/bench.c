@@ -0,0 +1,877 @@
+#include "../bitboard.h"
+#include "../board.h"
+#include "../endless.h"
+#include "../history.h"
+#include "../rng.h"
+
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+
+typedef struct {
+    usize w;
+    usize h;
+    usize mines;
+} Preset;
+
+static const Preset presets[] = {
+    { 9, 9, 10 },
+    { 16, 16, 40 },
+    { 20, 20, 80 },
+};
+
+static f64 now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void report(const char* name, const Preset* preset, bool safe, usize games, usize won, f64 elapsed)
+{
+    printf("%-10s %-6s " USIZE "x" USIZE "/" USIZE ": %12.0f games/s (%5.1f%% won)\n",
+        name, safe ? "safe" : "random", preset->w, preset->h, preset->mines,
+        games / elapsed, 100.0 * won / games);
+}
+
+// Next tile of a random order of all n tiles, shuffled lazily one
+// draw at a time (Fisher-Yates). Any permutation can be reshuffled, so
+// order only has to be filled once and a game starts at next = 0.
+static usize pick_next(usize* order, usize n, usize* next, RNG* rng)
+{
+    usize j = *next + rng_u64_cap(rng, n - *next);
+    usize tile = order[j];
+    order[j] = order[*next];
+    order[(*next)++] = tile;
+    return tile;
+}
+
+// Play games by opening random closed tiles until hitting a mine
+// or winning, starting with a click in the middle of the board. With
+// safe, only tiles without a mine are picked, so every game is played
+// to a win. Tiles are taken from a random order, skipping open ones,
+// which costs at most one draw per tile instead of ever more rejected
+// draws as the board fills up. Both engines pick tiles the same way and
+// keep track of the safe tiles left, so they only differ in how they
+// generate and explore.
+static void bench_games_board(const Preset* preset, bool safe, usize games, u64 seed)
+{
+    RNG_XoShiRo256ss rng_xoshiro = rng_xoshiro256ss(seed);
+    RNG* rng = (RNG*)&rng_xoshiro;
+    usize w = preset->w, h = preset->h;
+    Board board = board_init(w, h);
+    BoardExplorer explorer = board_explorer_init();
+    usize* order;
+    if (!(order = malloc(w * h * sizeof(usize)))) {
+        panic("Out of memory!");
+    }
+    for (usize p = 0; p < w * h; p++) {
+        order[p] = p;
+    }
+
+    usize won = 0;
+    f64 start = now();
+    for (usize g = 0; g < games; g++) {
+        usize next = 0;
+        board_clear(&board);
+        board_generate(&board, rng, preset->mines, w / 2, h / 2);
+        usize closed_safe = w * h - preset->mines;
+        usize i = board_index(&board, w / 2, h / 2);
+        while (!board.tiles[i].mine) {
+            explorer.opened_len = 0;
+            board_explorer_start(&explorer, &board, board_x(&board, i), board_y(&board, i));
+            board_explorer_step(&explorer, &board, ~(usize)0);
+            closed_safe -= explorer.opened_len;
+            if (closed_safe == 0) {
+                won++;
+                break;
+            }
+            do {
+                usize p = pick_next(order, w * h, &next, rng);
+                i = board_index(&board, p % w, p / w);
+            } while (board.tiles[i].open || (safe && board.tiles[i].mine));
+        }
+    }
+    report("board", preset, safe, games, won, now() - start);
+
+    free(order);
+    board_explorer_deinit(&explorer);
+    board_deinit(&board);
+}
+
+#define BENCH_GAMES_BITBOARD(_type, _name, _preset, _safe, _games, _seed)                              \
+    do {                                                                                               \
+        RNG_XoShiRo256ss rng_xoshiro = rng_xoshiro256ss(_seed);                                        \
+        RNG* rng = (RNG*)&rng_xoshiro;                                                                 \
+        usize order[_name##_w * _name##_h];                                                            \
+        for (usize p = 0; p < _name##_w * _name##_h; p++) {                                            \
+            order[p] = p;                                                                              \
+        }                                                                                              \
+        usize won = 0;                                                                                 \
+        f64 start = now();                                                                             \
+        for (usize g = 0; g < (_games); g++) {                                                         \
+            usize next = 0;                                                                            \
+            _type board;                                                                               \
+            _name##_generate(&board, rng, (_preset)->mines, _name##_w / 2, _name##_h / 2);             \
+            usize i = _name##_h / 2 * _name##_w + _name##_w / 2;                                       \
+            while (_name##_explore(&board, i % _name##_w, i / _name##_w)) {                            \
+                if (_name##_won(&board)) {                                                             \
+                    won++;                                                                             \
+                    break;                                                                             \
+                }                                                                                      \
+                do {                                                                                   \
+                    i = pick_next(order, _name##_w * _name##_h, &next, rng);                           \
+                } while (((board.open[i / 64] | ((_safe) ? board.mine[i / 64] : 0)) >> (i % 64)) & 1); \
+            }                                                                                          \
+        }                                                                                              \
+        report("bitboard", (_preset), (_safe), (_games), won, now() - start);                          \
+    } while (0)
+
+// Load the mines of a generated Board into a bitboard, then open the
+// same random tiles on both and panic if their mines, nearby mine
+// counts or open tiles ever differ. Every other game only opens safe
+// tiles, so the flood fill is also checked on boards played to a win.
+#define CHECK_GAMES_BITBOARD(_type, _name, _preset, _games, _seed)                                                \
+    do {                                                                                                          \
+        RNG_XoShiRo256ss rng_xoshiro = rng_xoshiro256ss(_seed);                                                   \
+        RNG* rng = (RNG*)&rng_xoshiro;                                                                            \
+        Board board = board_init(_name##_w, _name##_h);                                                           \
+        for (usize g = 0; g < (_games); g++) {                                                                    \
+            board_clear(&board);                                                                                  \
+            board_generate(&board, rng, (_preset)->mines, _name##_w / 2, _name##_h / 2);                          \
+            _type bitboard = { 0 };                                                                               \
+            for (usize i = 0; i < _name##_w * _name##_h; i++) {                                                   \
+                bool mine = board.tiles[board_index(&board, i % _name##_w, i / _name##_w)].mine;                  \
+                bitboard.mine[i / 64] |= (u64)mine << (i % 64);                                                   \
+            }                                                                                                     \
+            _name##_count(&bitboard);                                                                             \
+            usize i = _name##_h / 2 * _name##_w + _name##_w / 2;                                                  \
+            for (;;) {                                                                                            \
+                usize x = i % _name##_w, y = i / _name##_w;                                                       \
+                bool safe = _name##_explore(&bitboard, x, y);                                                     \
+                if (safe) {                                                                                       \
+                    board_explore(&board, x, y);                                                                  \
+                }                                                                                                 \
+                for (usize j = 0; j < _name##_w * _name##_h; j++) {                                               \
+                    const Tile* tile = &board.tiles[board_index(&board, j % _name##_w, j / _name##_w)];           \
+                    if (tile->mine != ((bitboard.mine[j / 64] >> (j % 64)) & 1)                                   \
+                        || tile->open != ((bitboard.open[j / 64] >> (j % 64)) & 1)                                \
+                        || tile->nearby_mines != _name##_nearby_mines(&bitboard, j % _name##_w, j / _name##_w)) { \
+                        panic(#_name " differs from Board in game " USIZE " at tile " USIZE, g, j);               \
+                    }                                                                                             \
+                }                                                                                                 \
+                if (!safe || _name##_won(&bitboard)) {                                                            \
+                    break;                                                                                        \
+                }                                                                                                 \
+                do {                                                                                              \
+                    i = rng_u64_cap(rng, _name##_w * _name##_h);                                                  \
+                } while (((bitboard.open[i / 64] | (g % 2 ? bitboard.mine[i / 64] : 0)) >> (i % 64)) & 1);        \
+            }                                                                                                     \
+        }                                                                                                         \
+        board_deinit(&board);                                                                                     \
+    } while (0)
+
+// Number of games checked before timing
+#define BENCH_GAMES_CHECKED 1000
+
+static void bench_games(usize games, u64 seed)
+{
+    CHECK_GAMES_BITBOARD(Bitboard9x9, bitboard9x9, &presets[0], BENCH_GAMES_CHECKED, seed);
+    CHECK_GAMES_BITBOARD(Bitboard16x16, bitboard16x16, &presets[1], BENCH_GAMES_CHECKED, seed);
+    CHECK_GAMES_BITBOARD(Bitboard20x20, bitboard20x20, &presets[2], BENCH_GAMES_CHECKED, seed);
+
+    for (usize safe = 0; safe < 2; safe++) {
+        for (usize i = 0; i < arrlen(presets); i++) {
+            bench_games_board(&presets[i], safe, games, seed);
+        }
+        BENCH_GAMES_BITBOARD(Bitboard9x9, bitboard9x9, &presets[0], safe, games, seed);
+        BENCH_GAMES_BITBOARD(Bitboard16x16, bitboard16x16, &presets[1], safe, games, seed);
+        BENCH_GAMES_BITBOARD(Bitboard20x20, bitboard20x20, &presets[2], safe, games, seed);
+    }
+}
+
+static const usize neighbours_sizes[][2] = {
+    { 16, 16 },
+    { 256, 256 },
+    { 2048, 2048 },
+};
+
+// Neighbour walk of the unpadded layout used before boards were padded,
+// with an offset table and four bounds checks for every neighbour
+static void count_checked(const bool* mines, u8* counts, usize w, usize h)
+{
+    for (usize y = 0; y < h; y++) {
+        for (usize x = 0; x < w; x++) {
+            isize offsets[8][2] = {
+                { -1, -1 },
+                { 0, -1 },
+                { 1, -1 },
+                { -1, 0 },
+                { 1, 0 },
+                { -1, 1 },
+                { 0, 1 },
+                { 1, 1 },
+            };
+            u8 count = 0;
+            for (usize i = 0; i < arrlen(offsets); i++) {
+                isize cx = x + offsets[i][0];
+                isize cy = y + offsets[i][1];
+                if (cx < 0 || cy < 0 || cx >= w || cy >= h) {
+                    continue;
+                }
+                count += mines[cy * w + cx];
+            }
+            counts[y * w + x] = count;
+        }
+    }
+}
+
+// Reference counts for a torus, wrapping every neighbour with a modulo
+static void count_wrapped(const bool* mines, u8* counts, usize w, usize h)
+{
+    for (usize y = 0; y < h; y++) {
+        for (usize x = 0; x < w; x++) {
+            u8 count = 0;
+            for (usize dy = 0; dy < 3; dy++) {
+                for (usize dx = 0; dx < 3; dx++) {
+                    if (dx == 1 && dy == 1) {
+                        continue;
+                    }
+                    count += mines[(y + h + dy - 1) % h * w + (x + w + dx - 1) % w];
+                }
+            }
+            counts[y * w + x] = count;
+        }
+    }
+}
+
+static void count_padded(const Board* board, u8* counts)
+{
+    for (usize y = 0; y < board->h; y++) {
+        for (usize x = 0; x < board->w; x++) {
+            usize index = board_index(board, x, y);
+            usize neighbours[8];
+            board_neighbours(board, index, neighbours);
+            u8 count = 0;
+            for (usize i = 0; i < arrlen(neighbours); i++) {
+                count += board->tiles[neighbours[i]].mine;
+            }
+            counts[y * board->w + x] = count;
+        }
+    }
+}
+
+// Count nearby mines for every tile, with the bounds-checked walk
+// and the padded walk on bounded and torus boards
+static void bench_neighbours(usize n, u64 seed)
+{
+    for (usize s = 0; s < arrlen(neighbours_sizes); s++) {
+        usize w = neighbours_sizes[s][0], h = neighbours_sizes[s][1];
+        // Visit about as many tiles as n 16x16 boards
+        usize passes = max(n * 256 / (w * h), 1);
+
+        RNG_XoShiRo256ss rng_xoshiro = rng_xoshiro256ss(seed);
+        Board board = board_init(w, h);
+        Board torus = board_init_ex(w, h, BOARD_TOPOLOGY_TORUS);
+        board_generate(&board, (RNG*)&rng_xoshiro, w * h / 6, w / 2, h / 2);
+        bool* mines;
+        u8* counts;
+        u8* expected;
+        if (!(mines = malloc(w * h * sizeof(bool)))
+            || !(counts = malloc(w * h))
+            || !(expected = malloc(w * h))) {
+            panic("Out of memory!");
+        }
+        for (usize y = 0; y < h; y++) {
+            for (usize x = 0; x < w; x++) {
+                mines[y * w + x] = board.tiles[board_index(&board, x, y)].mine;
+                torus.tiles[board_index(&torus, x, y)].mine = mines[y * w + x];
+            }
+        }
+
+        f64 start = now();
+        for (usize p = 0; p < passes; p++) {
+            count_checked(mines, expected, w, h);
+        }
+        f64 checked = now() - start;
+
+        start = now();
+        for (usize p = 0; p < passes; p++) {
+            count_padded(&board, counts);
+        }
+        f64 padded = now() - start;
+        if (memcmp(counts, expected, w * h) != 0) {
+            panic("padded neighbour counts differ from the checked ones");
+        }
+
+        start = now();
+        for (usize p = 0; p < passes; p++) {
+            count_padded(&torus, counts);
+        }
+        f64 wrapped = now() - start;
+        count_wrapped(mines, expected, w, h);
+        if (memcmp(counts, expected, w * h) != 0) {
+            panic("torus neighbour counts differ from the wrapped ones");
+        }
+
+        f64 tiles = (f64)passes * w * h;
+        printf("checked %5" PRIuPTR "x%-5" PRIuPTR ": %8.1f Mtiles/s\n", w, h, tiles / checked / 1e6);
+        printf("padded  %5" PRIuPTR "x%-5" PRIuPTR ": %8.1f Mtiles/s\n", w, h, tiles / padded / 1e6);
+        printf("torus   %5" PRIuPTR "x%-5" PRIuPTR ": %8.1f Mtiles/s\n", w, h, tiles / wrapped / 1e6);
+
+        free(mines);
+        free(counts);
+        free(expected);
+        board_deinit(&board);
+        board_deinit(&torus);
+    }
+}
+
+static const usize explore_sizes[][2] = {
+    { 1024, 1024 },
+    { 2048, 2048 },
+};
+
+static const usize explore_threads[] = { 1, 2, 4, 8 };
+
+typedef enum {
+    EXPLORE_RANDOM, // mostly empty, the frontier is a wide ring
+    EXPLORE_MAZE, // a single winding corridor, the frontier stays tiny
+} ExploreLayout;
+
+static const struct {
+    const char* name;
+    BoardTopology topology;
+    ExploreLayout layout;
+} explore_layouts[] = {
+    { "bounded", BOARD_TOPOLOGY_BOUNDED, EXPLORE_RANDOM },
+    { "torus", BOARD_TOPOLOGY_TORUS, EXPLORE_RANDOM },
+    { "maze", BOARD_TOPOLOGY_BOUNDED, EXPLORE_MAZE },
+};
+
+// Walls of mines on every 4th row, leaving a gap of 4 tiles at
+// alternating ends, so the tiles without nearby mines form one
+// corridor snaking through the board along the rows in between
+static void explore_maze(Board* board)
+{
+    for (usize y = 0; y < board->h; y += 4) {
+        usize x0 = y / 4 % 2 == 0 ? 0 : 4;
+        usize x1 = y / 4 % 2 == 0 ? board->w - 4 : board->w;
+        for (usize x = x0; x < x1; x++) {
+            board->tiles[board_index(board, x, y)].mine = true;
+        }
+    }
+    for (usize y = 0; y < board->h; y++) {
+        for (usize x = 0; x < board->w; x++) {
+            usize neighbours[8];
+            board_neighbours(board, board_index(board, x, y), neighbours);
+            u8 count = 0;
+            for (usize i = 0; i < arrlen(neighbours); i++) {
+                count += board->tiles[neighbours[i]].mine;
+            }
+            board->tiles[board_index(board, x, y)].nearby_mines = count;
+        }
+    }
+}
+
+// Flood fill a board from near the middle with board_explore and
+// board_explore_parallel, for every layout. Both sizes are above
+// BOARD_PARALLEL_EXPLORE_MIN_TILES, so every thread count above 1
+// takes the parallel path and is checked against the sequential result.
+static void bench_explore(usize n, u64 seed)
+{
+    for (usize s = 0; s < arrlen(explore_sizes); s++) {
+        usize w = explore_sizes[s][0], h = explore_sizes[s][1];
+        // Fill about as many tiles as n / 4 16x16 boards
+        usize passes = max(n * 64 / (w * h), 1);
+
+        for (usize l = 0; l < arrlen(explore_layouts); l++) {
+            BoardTopology topology = explore_layouts[l].topology;
+            Board initial = board_init_ex(w, h, topology);
+            Board expected = board_init_ex(w, h, topology);
+            Board board = board_init_ex(w, h, topology);
+            // Row 2 is in the middle of the maze's first corridor
+            usize x = w / 2, y = h / 2;
+            if (explore_layouts[l].layout == EXPLORE_MAZE) {
+                explore_maze(&initial);
+                y = 2;
+            } else {
+                RNG_XoShiRo256ss rng_xoshiro = rng_xoshiro256ss(seed);
+                board_generate(&initial, (RNG*)&rng_xoshiro, w * h / 64, x, y);
+            }
+            usize tiles_len = board_tiles_len(&initial) * sizeof(Tile);
+            memcpy(expected.tiles, initial.tiles, tiles_len);
+            board_explore(&expected, x, y);
+
+            usize opened = 0;
+            for (usize i = 0; i < board_tiles_len(&expected); i++) {
+                opened += expected.tiles[i].open != initial.tiles[i].open;
+            }
+
+            for (usize t = 0; t < arrlen(explore_threads); t++) {
+                f64 elapsed = 0.0;
+                for (usize p = 0; p < passes; p++) {
+                    memcpy(board.tiles, initial.tiles, tiles_len);
+                    f64 start = now();
+                    board_explore_parallel(&board, x, y, explore_threads[t]);
+                    elapsed += now() - start;
+                    if (memcmp(board.tiles, expected.tiles, tiles_len) != 0) {
+                        panic("parallel explore with " USIZE " threads differs from board_explore", explore_threads[t]);
+                    }
+                }
+                printf("%-7s %5" PRIuPTR "x%-5" PRIuPTR " %" PRIuPTR " threads: %8.1f Mtiles/s\n",
+                    explore_layouts[l].name, w, h, explore_threads[t],
+                    (f64)passes * opened / elapsed / 1e6);
+            }
+
+            board_deinit(&initial);
+            board_deinit(&expected);
+            board_deinit(&board);
+        }
+    }
+}
+
+// Board size and moves per game of the history check, large
+// enough for snapshot trees with two levels of inner nodes
+#define HISTORY_SIZE 200
+#define HISTORY_MINES 4000
+#define HISTORY_MOVES 256
+
+// Check that every node of a snapshot tree is only referenced by its
+// parent (or the caller, for the root) and that its leaves hold tiles
+static void history_check_tree(const HistoryNode* node, usize level, const Tile* tiles, usize tiles_len, usize first_chunk)
+{
+    if (node->refs != 1) {
+        panic("history node at level " USIZE " has " USIZE " references after history_deinit", level, node->refs);
+    }
+    usize chunks = 1;
+    for (usize i = 0; i < level; i++) {
+        chunks *= HISTORY_FANOUT;
+    }
+    if (level == 0) {
+        usize start = first_chunk * HISTORY_CHUNK_TILES;
+        usize len = min(HISTORY_CHUNK_TILES, tiles_len - start);
+        if (memcmp(((const HistoryLeaf*)node)->tiles, tiles + start, len * sizeof(Tile)) != 0) {
+            panic("history chunk " USIZE " differs from its board state", first_chunk);
+        }
+        return;
+    }
+    const HistoryInner* inner = (const HistoryInner*)node;
+    for (usize i = 0; i < HISTORY_FANOUT && inner->children[i]; i++) {
+        history_check_tree(inner->children[i], level - 1, tiles, tiles_len, first_chunk + i * chunks / HISTORY_FANOUT);
+    }
+}
+
+static void history_expect(const Board* board, const Tile* state, const char* what, usize move)
+{
+    if (memcmp(board->tiles, state, board_tiles_len(board) * sizeof(Tile)) != 0) {
+        panic("board differs from state " USIZE " after %s", move, what);
+    }
+}
+
+// Play random opens and flags with a history, keeping a full copy of
+// every committed state. Then walk back and forth through the history
+// with undo, redo and checkout, panicking if the board ever differs
+// from the copy of the state it should be in. Finally, a snapshot
+// held past history_deinit must be left with a single reference on
+// every node and still hold its state.
+static void bench_history(usize n, u64 seed)
+{
+    usize games = max(n / 10000, 1);
+    RNG_XoShiRo256ss rng_xoshiro = rng_xoshiro256ss(seed);
+    RNG* rng = (RNG*)&rng_xoshiro;
+    Board board = board_init(HISTORY_SIZE, HISTORY_SIZE);
+    BoardExplorer explorer = board_explorer_init();
+    usize tiles_len = board_tiles_len(&board);
+    Tile* states;
+    if (!(states = malloc((HISTORY_MOVES + 1) * tiles_len * sizeof(Tile)))) {
+        panic("Out of memory!");
+    }
+
+    f64 commit_time = 0.0, restore_time = 0.0;
+    usize commits = 0, restores = 0;
+    for (usize g = 0; g < games; g++) {
+        board_clear(&board);
+        board_generate(&board, rng, HISTORY_MINES, HISTORY_SIZE / 2, HISTORY_SIZE / 2);
+        History history = history_init(&board);
+        memcpy(states, board.tiles, tiles_len * sizeof(Tile));
+
+        for (usize m = 1; m <= HISTORY_MOVES; m++) {
+            usize index;
+            do {
+                index = board_index(&board, rng_u64_cap(rng, HISTORY_SIZE), rng_u64_cap(rng, HISTORY_SIZE));
+            } while (board.tiles[index].open || board.tiles[index].mine);
+            if (board.tiles[index].flag || rng_u64_cap(rng, 4) == 0) {
+                board.tiles[index].flag = !board.tiles[index].flag;
+                history_touch(&history, index);
+            } else {
+                explorer.opened_len = 0;
+                board_explorer_start(&explorer, &board, board_x(&board, index), board_y(&board, index));
+                board_explorer_step(&explorer, &board, ~(usize)0);
+                for (usize i = 0; i < explorer.opened_len; i++) {
+                    history_touch(&history, explorer.opened[i]);
+                }
+            }
+            f64 start = now();
+            history_commit(&history, &board);
+            commit_time += now() - start;
+            commits++;
+            memcpy(states + m * tiles_len, board.tiles, tiles_len * sizeof(Tile));
+        }
+
+        // All the way back and forth, then a random walk
+        f64 start = now();
+        for (usize m = HISTORY_MOVES; m-- > 0;) {
+            if (!history_undo(&history, &board)) {
+                panic("history_undo failed at state " USIZE, m);
+            }
+            history_expect(&board, states + m * tiles_len, "undo", m);
+        }
+        if (history_undo(&history, &board)) {
+            panic("history_undo went past the first state");
+        }
+        for (usize m = 1; m <= HISTORY_MOVES; m++) {
+            if (!history_redo(&history, &board)) {
+                panic("history_redo failed at state " USIZE, m);
+            }
+            history_expect(&board, states + m * tiles_len, "redo", m);
+        }
+        if (history_redo(&history, &board)) {
+            panic("history_redo went past the last state");
+        }
+        usize cursor = HISTORY_MOVES;
+        for (usize i = 0; i < HISTORY_MOVES; i++) {
+            if (cursor > 0 && (cursor == HISTORY_MOVES || rng_u64_cap(rng, 2) == 0)) {
+                history_undo(&history, &board);
+                cursor--;
+            } else {
+                history_redo(&history, &board);
+                cursor++;
+            }
+            history_expect(&board, states + cursor * tiles_len, "random undo and redo", cursor);
+        }
+        restore_time += now() - start;
+        restores += HISTORY_MOVES * 3;
+        history.changed_len = 0;
+
+        // Branch off an earlier state and come back to it with checkout,
+        // which discards the redo states past the branch
+        usize held = cursor;
+        Snapshot snapshot = history_snapshot(&history);
+        while (history_undo(&history, &board)) { }
+        history_checkout(&history, &board, snapshot);
+        history_expect(&board, states + held * tiles_len, "checkout", held);
+        if (history_redo(&history, &board)) {
+            panic("history_redo went past a checkout");
+        }
+        history_undo(&history, &board);
+        history_expect(&board, states, "undoing a checkout", 0);
+
+        // Only the release below needs history after deinit, through its depth
+        history_deinit(&history);
+        history_check_tree(snapshot.root, history.depth, states + held * tiles_len, tiles_len, 0);
+        history_snapshot_release(&history, snapshot);
+    }
+
+    printf("commit  %dx%d: %8.1f us\n", HISTORY_SIZE, HISTORY_SIZE, commit_time / commits * 1e6);
+    printf("restore %dx%d: %8.1f us\n", HISTORY_SIZE, HISTORY_SIZE, restore_time / restores * 1e6);
+
+    free(states);
+    board_explorer_deinit(&explorer);
+    board_deinit(&board);
+}
+
+// Chunks per side of the area checked across seams per round, and
+// chunks past the archive capacity in the archive check
+#define ENDLESS_SEAM_CHUNKS 4
+#define ENDLESS_SEAM_SIZE (ENDLESS_SEAM_CHUNKS * ENDLESS_CHUNK_SIZE)
+#define ENDLESS_DROPPED 1024
+
+// Read the open and flag rows of a chunk through endless_tile
+static void endless_read_chunk(EndlessBoard* board, i64 cx, i64 cy, u32 open[ENDLESS_CHUNK_SIZE], u32 flag[ENDLESS_CHUNK_SIZE])
+{
+    for (usize y = 0; y < ENDLESS_CHUNK_SIZE; y++) {
+        open[y] = flag[y] = 0;
+        for (usize x = 0; x < ENDLESS_CHUNK_SIZE; x++) {
+            Tile tile;
+            endless_tile(board, cx * ENDLESS_CHUNK_SIZE + x, cy * ENDLESS_CHUNK_SIZE + y, &tile);
+            open[y] |= (u32)tile.open << x;
+            flag[y] |= (u32)tile.flag << x;
+        }
+    }
+}
+
+// Spread a chunk index over a band of chunks around a base chunk
+static void endless_spread(usize i, i64 base, i64* cx, i64* cy)
+{
+    *cx = base + (i64)(i % 1024) - 512;
+    *cy = base + (i64)(i / 1024) - 512;
+}
+
+// Three checks of endless mode, panicking on the first mismatch:
+// - nearby mine counts of hot chunks against a brute-force count over
+//   the mines of all tiles around them, across chunk seams, starting
+//   at the origin and then at random far away (and negative) chunks
+// - open and flag rows of twice as many chunks as the table holds,
+//   read back after they were pushed out into the archive
+// - flags past the archive capacity: the least recently archived
+//   chunks are dropped, all the others keep their flag
+static void bench_endless(usize n, u64 seed)
+{
+    usize rounds = max(n / 1000, 1);
+    RNG_XoShiRo256ss rng_xoshiro = rng_xoshiro256ss(seed);
+    RNG* rng = (RNG*)&rng_xoshiro;
+
+    EndlessBoard board = endless_init(seed);
+    bool* mines;
+    if (!(mines = malloc(ENDLESS_SEAM_SIZE * ENDLESS_SEAM_SIZE * sizeof(bool)))) {
+        panic("Out of memory!");
+    }
+    f64 generate_time = 0.0;
+    for (usize r = 0; r < rounds; r++) {
+        i64 cx0 = r == 0 ? -ENDLESS_SEAM_CHUNKS / 2 : (i64)rng_u64_cap(rng, (u64)1 << 33) - ((i64)1 << 32);
+        i64 cy0 = r == 0 ? -ENDLESS_SEAM_CHUNKS / 2 : (i64)rng_u64_cap(rng, (u64)1 << 33) - ((i64)1 << 32);
+        i64 x0 = cx0 * ENDLESS_CHUNK_SIZE;
+        i64 y0 = cy0 * ENDLESS_CHUNK_SIZE;
+
+        // Only chunks with player state are kept, so flag a tile in each
+        for (i64 cy = cy0; cy < cy0 + ENDLESS_SEAM_CHUNKS; cy++) {
+            for (i64 cx = cx0; cx < cx0 + ENDLESS_SEAM_CHUNKS; cx++) {
+                endless_flag(&board, cx * ENDLESS_CHUNK_SIZE, cy * ENDLESS_CHUNK_SIZE);
+            }
+        }
+        f64 start = now();
+        endless_prefetch(&board, x0, y0, x0 + ENDLESS_SEAM_SIZE - 1, y0 + ENDLESS_SEAM_SIZE - 1, ~(usize)0);
+        generate_time += now() - start;
+
+        for (usize y = 0; y < ENDLESS_SEAM_SIZE; y++) {
+            for (usize x = 0; x < ENDLESS_SEAM_SIZE; x++) {
+                Tile tile;
+                if (!endless_tile(&board, x0 + x, y0 + y, &tile)) {
+                    panic("endless tile " I64 ", " I64 " isn't hot after prefetching it", x0 + x, y0 + y);
+                }
+                mines[y * ENDLESS_SEAM_SIZE + x] = tile.mine;
+            }
+        }
+        for (usize y = 1; y + 1 < ENDLESS_SEAM_SIZE; y++) {
+            for (usize x = 1; x + 1 < ENDLESS_SEAM_SIZE; x++) {
+                u8 expected = 0;
+                for (usize ny = y - 1; ny <= y + 1; ny++) {
+                    for (usize nx = x - 1; nx <= x + 1; nx++) {
+                        expected += (nx != x || ny != y) && mines[ny * ENDLESS_SEAM_SIZE + nx];
+                    }
+                }
+                Tile tile;
+                endless_tile(&board, x0 + x, y0 + y, &tile);
+                if (tile.nearby_mines != expected) {
+                    panic("endless tile " I64 ", " I64 " has %d nearby mines, expected %d", x0 + x, y0 + y, tile.nearby_mines, expected);
+                }
+            }
+        }
+    }
+    free(mines);
+    endless_deinit(&board);
+    printf("generate:  %8.1f us/chunk\n", generate_time / (rounds * ENDLESS_SEAM_CHUNKS * ENDLESS_SEAM_CHUNKS) * 1e6);
+
+    // A full flagged row, a single flag and an open tile per
+    // chunk, so rows of every packed form get archived
+    usize chunks = ENDLESS_MAX_CHUNKS * 2;
+    u32(*expected)[2][ENDLESS_CHUNK_SIZE];
+    if (!(expected = malloc(chunks * sizeof(*expected)))) {
+        panic("Out of memory!");
+    }
+    board = endless_init(seed);
+    EndlessExplorer explorer = endless_explorer_init();
+    i64 base = (i64)rng_u64_cap(rng, (u64)1 << 33) - ((i64)1 << 32);
+    for (usize i = 0; i < chunks; i++) {
+        i64 cx, cy;
+        endless_spread(i, base, &cx, &cy);
+        i64 x0 = cx * ENDLESS_CHUNK_SIZE;
+        i64 y0 = cy * ENDLESS_CHUNK_SIZE;
+        // Only the start tile is opened, the flood fill is never stepped
+        endless_explorer_start(&explorer, &board, x0 + rng_u64_cap(rng, ENDLESS_CHUNK_SIZE), y0 + rng_u64_cap(rng, ENDLESS_CHUNK_SIZE));
+        explorer.queue_len = 0;
+        i64 row = y0 + rng_u64_cap(rng, ENDLESS_CHUNK_SIZE);
+        for (usize x = 0; x < ENDLESS_CHUNK_SIZE; x++) {
+            endless_flag(&board, x0 + x, row);
+        }
+        endless_flag(&board, x0 + rng_u64_cap(rng, ENDLESS_CHUNK_SIZE), y0 + rng_u64_cap(rng, ENDLESS_CHUNK_SIZE));
+        endless_read_chunk(&board, cx, cy, expected[i][0], expected[i][1]);
+    }
+    if (board.archived_len == 0) {
+        panic("no endless chunks were archived");
+    }
+    f64 start = now();
+    for (usize i = 0; i < chunks; i++) {
+        i64 cx, cy;
+        endless_spread(i, base, &cx, &cy);
+        u32 rows[2][ENDLESS_CHUNK_SIZE];
+        endless_read_chunk(&board, cx, cy, rows[0], rows[1]);
+        if (memcmp(rows, expected[i], sizeof(rows)) != 0) {
+            panic("endless chunk " I64 ", " I64 " changed after archiving and restoring it", cx, cy);
+        }
+    }
+    printf("restore:   %8.1f us/chunk\n", (now() - start) / chunks * 1e6);
+    free(expected);
+    endless_explorer_deinit(&explorer);
+    endless_deinit(&board);
+
+    // Flags on one tile per chunk, chunks is just past what the table
+    // and archive together hold, so the first ones get dropped
+    chunks = ENDLESS_MAX_CHUNKS + ENDLESS_MAX_ARCHIVED + ENDLESS_DROPPED;
+    board = endless_init(seed);
+    start = now();
+    for (usize i = 0; i < chunks; i++) {
+        i64 cx, cy;
+        endless_spread(i, base, &cx, &cy);
+        endless_flag(&board, cx * ENDLESS_CHUNK_SIZE + i % ENDLESS_CHUNK_SIZE, cy * ENDLESS_CHUNK_SIZE);
+    }
+    printf("archive:   %8.1f us/chunk\n", (now() - start) / chunks * 1e6);
+    if (board.archived_len != ENDLESS_MAX_ARCHIVED) {
+        panic("endless archive holds " USIZE " chunks, expected " USIZE, board.archived_len, (usize)ENDLESS_MAX_ARCHIVED);
+    }
+    for (usize i = 0; i < chunks; i++) {
+        i64 cx, cy;
+        endless_spread(i, base, &cx, &cy);
+        Tile tile;
+        endless_tile(&board, cx * ENDLESS_CHUNK_SIZE + i % ENDLESS_CHUNK_SIZE, cy * ENDLESS_CHUNK_SIZE, &tile);
+        if (tile.flag != (i >= ENDLESS_DROPPED)) {
+            panic("endless chunk " USIZE " %s its flag past the archive capacity", i, tile.flag ? "kept" : "lost");
+        }
+    }
+    endless_deinit(&board);
+}
+
+#define BENCH_RNG_THREADS 4
+
+typedef struct {
+    RNG* rng;
+    usize draws;
+    u64 sum; // keeps the draws from being optimized out
+    pthread_t thread;
+} RngWorker;
+
+static void* rng_worker_run(void* _self)
+{
+    RngWorker* self = _self;
+    u64 sum = 0;
+    for (usize i = 0; i < self->draws; i++) {
+        sum += rng_next(self->rng);
+    }
+    self->sum = sum;
+    return NULL;
+}
+
+// Draw from one generator per thread, returns draws per second
+static f64 bench_rng_threads(RNG* rngs[BENCH_RNG_THREADS], usize draws)
+{
+    RngWorker workers[BENCH_RNG_THREADS];
+    f64 start = now();
+    for (usize i = 0; i < BENCH_RNG_THREADS; i++) {
+        workers[i] = (RngWorker) { .rng = rngs[i], .draws = draws };
+        if (pthread_create(&workers[i].thread, NULL, rng_worker_run, &workers[i]) != 0) {
+            panic("failed to create benchmark thread");
+        }
+    }
+    for (usize i = 0; i < BENCH_RNG_THREADS; i++) {
+        pthread_join(workers[i].thread, NULL);
+    }
+    return BENCH_RNG_THREADS * draws / (now() - start);
+}
+
+// Jump and long jump, and threads drawing from neighbouring
+// generators with and without a cache line each
+static void bench_rng(usize n, u64 seed)
+{
+    RNG_XoShiRo256ss rng = rng_xoshiro256ss(seed);
+    usize jumps = max(n / 10, 1);
+    f64 start = now();
+    for (usize i = 0; i < jumps; i++) {
+        rng_xoshiro256ss_jump(&rng);
+    }
+    printf("jump:      %12.0f jumps/s\n", jumps / (now() - start));
+    start = now();
+    for (usize i = 0; i < jumps; i++) {
+        rng_xoshiro256ss_long_jump(&rng);
+    }
+    printf("long jump: %12.0f jumps/s\n", jumps / (now() - start));
+
+    usize draws = n * 1000;
+    RNG_XoShiRo256ss packed[BENCH_RNG_THREADS];
+    RNGStreamPool pool = rng_stream_pool_init(seed, BENCH_RNG_THREADS);
+    RNG* rngs[BENCH_RNG_THREADS];
+    for (usize i = 0; i < BENCH_RNG_THREADS; i++) {
+        packed[i] = pool.streams[i].rng;
+        rngs[i] = (RNG*)&packed[i];
+    }
+    printf("packed:    %12.0f draws/s (%d threads)\n", bench_rng_threads(rngs, draws), BENCH_RNG_THREADS);
+    for (usize i = 0; i < BENCH_RNG_THREADS; i++) {
+        rngs[i] = rng_stream_pool_get(&pool, i);
+    }
+    printf("pool:      %12.0f draws/s (%d threads)\n", bench_rng_threads(rngs, draws), BENCH_RNG_THREADS);
+    rng_stream_pool_deinit(&pool);
+}
+
+static void print_usage(int argc, const char** argv)
+{
+    const char* progname = argc > 0 ? argv[0] : "bench";
+    fprintf(stderr, "Usage:\n");
+    fprintf(stderr, "  %s [options] [benchmark...]\n", progname);
+    fprintf(stderr, "Options:\n");
+    fprintf(stderr, "  -n <number> -- iterations per benchmark (default: 100000)\n");
+    fprintf(stderr, "  -s <number> -- seed (default: 1)\n");
+    fprintf(stderr, "Benchmarks (default: all):\n");
+    fprintf(stderr, "  games      -- random-click and played-to-win games on the standard sizes, Board vs. bitboard engine\n");
+    fprintf(stderr, "  neighbours -- nearby mine counts, bounds-checked vs. padded neighbour walk\n");
+    fprintf(stderr, "  explore    -- flood fill of large open and maze boards, sequential vs. parallel by thread count\n");
+    fprintf(stderr, "  history    -- undo, redo and checkout through copy-on-write snapshots, checked against full copies\n");
+    fprintf(stderr, "  endless    -- endless chunk generation checked across seams, archive round-trips and capacity\n");
+    fprintf(stderr, "  rng        -- jumps, and per-thread generators packed vs. in a stream pool\n");
+}
+
+int main(int argc, const char** argv)
+{
+    // Parse options
+    usize n = 100000;
+    u64 seed = 1;
+    const char* selected[8];
+    usize selected_len = 0;
+    for (int i = 1; i < argc; i++) {
+        const char* param = i + 1 < argc ? argv[i + 1] : NULL;
+        if (strcmp(argv[i], "-n") == 0 && param && sscanf(param, USIZE, &n) == 1) {
+            i++;
+        } else if (strcmp(argv[i], "-s") == 0 && param && sscanf(param, U64, &seed) == 1) {
+            i++;
+        } else if (argv[i][0] != '-' && selected_len < arrlen(selected)) {
+            selected[selected_len++] = argv[i];
+        } else {
+            print_usage(argc, argv);
+            return 1;
+        }
+    }
+
+    static const struct {
+        const char* name;
+        void (*run)(usize n, u64 seed);
+    } benchmarks[] = {
+        { "games", bench_games },
+        { "neighbours", bench_neighbours },
+        { "explore", bench_explore },
+        { "history", bench_history },
+        { "endless", bench_endless },
+        { "rng", bench_rng },
+    };
+
+    for (usize i = 0; i < arrlen(benchmarks); i++) {
+        bool run = selected_len == 0;
+        for (usize j = 0; j < selected_len; j++) {
+            run |= strcmp(selected[j], benchmarks[i].name) == 0;
+        }
+        if (run) {
+            printf("== %s ==\n", benchmarks[i].name);
+            benchmarks[i].run(n, seed);
+        }
+    }
+
+    return 0;
+}
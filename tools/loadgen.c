@@ -0,0 +1,285 @@
+#include "../server.h"
+
+#include <errno.h>
+#include <pthread.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+typedef struct {
+    const char* socket_path;
+    f64 duration;
+    u64 seed;
+    pthread_t thread;
+    // Latency of every request in nanoseconds
+    u64* latencies;
+    usize latencies_len;
+    usize latencies_cap;
+    usize games;
+    bool failed;
+} Client;
+
+static u64 now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (u64)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+// splitmix64, good enough for picking tiles
+static u64 next_random(u64* state)
+{
+    u64 z = (*state += (u64)0x9E3779B97F4A7C15);
+    z = (z ^ (z >> 30)) * (u64)0xBF58476D1CE4E5B9;
+    z = (z ^ (z >> 27)) * (u64)0x94D049BB133111EB;
+    return z ^ (z >> 31);
+}
+
+static bool send_all(int fd, const u8* buf, usize len)
+{
+    while (len > 0) {
+        isize n = send(fd, buf, len, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        buf += n;
+        len -= n;
+    }
+    return true;
+}
+
+static bool recv_all(int fd, u8* buf, usize len)
+{
+    while (len > 0) {
+        isize n = recv(fd, buf, len, 0);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        buf += n;
+        len -= n;
+    }
+    return true;
+}
+
+// Send a request and wait for its response, payload is resized to fit
+static bool request(Client* self, int fd, const u8* req, usize req_len, u8* status, u8** payload, usize* payload_len, usize* payload_cap)
+{
+    u64 start = now_ns();
+
+    u8 header[RESPONSE_HEADER_SIZE];
+    if (!send_all(fd, req, req_len) || !recv_all(fd, header, sizeof(header))) {
+        return false;
+    }
+    *status = header[1];
+    *payload_len = get_u32(header + 2);
+    if (*payload_len > *payload_cap) {
+        *payload_cap = *payload_len;
+        if (!(*payload = realloc(*payload, *payload_cap))) {
+            panic("Out of memory!");
+        }
+    }
+    if (!recv_all(fd, *payload, *payload_len)) {
+        return false;
+    }
+
+    if (self->latencies_len == self->latencies_cap) {
+        self->latencies_cap = max(self->latencies_cap * 2, 4096);
+        if (!(self->latencies = realloc(self->latencies, self->latencies_cap * sizeof(u64)))) {
+            panic("Out of memory!");
+        }
+    }
+    self->latencies[self->latencies_len++] = now_ns() - start;
+    return true;
+}
+
+static void* client_run(void* _self)
+{
+    Client* self = _self;
+
+    struct sockaddr_un addr = { .sun_family = AF_UNIX };
+    strncpy(addr.sun_path, self->socket_path, sizeof(addr.sun_path) - 1);
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || connect(fd, (struct sockaddr*)&addr, sizeof(addr)) < 0) {
+        log_err("failed to connect to %s: %s", self->socket_path, strerror(errno));
+        self->failed = true;
+        return NULL;
+    }
+
+    static const u16 sizes[][3] = {
+        { 9, 9, 10 },
+        { 16, 16, 40 },
+        { 20, 20, 80 },
+    };
+
+    u8* payload = NULL;
+    usize payload_len = 0, payload_cap = 0;
+    u8* opened = NULL;
+    u64 end = now_ns() + self->duration * 1e9;
+    while (now_ns() < end) {
+        const u16* size = sizes[next_random(&self->seed) % arrlen(sizes)];
+        usize w = size[0], h = size[1];
+
+        u8 req[32];
+        u8 status;
+        req[0] = REQUEST_NEW_GAME;
+        put_u16(req + 1, w);
+        put_u16(req + 3, h);
+        put_u32(req + 5, size[2]);
+        put_u64(req + 9, next_random(&self->seed));
+        if (!request(self, fd, req, 1 + request_body_size[REQUEST_NEW_GAME], &status, &payload, &payload_len, &payload_cap)
+            || status != RESPONSE_OK) {
+            self->failed = true;
+            break;
+        }
+        u32 session = get_u32(payload);
+
+        // Open random closed tiles until the game is over
+        if (!(opened = realloc(opened, w * h))) {
+            panic("Out of memory!");
+        }
+        memset(opened, 0, w * h);
+        while (status == RESPONSE_OK) {
+            usize index;
+            do {
+                index = next_random(&self->seed) % (w * h);
+            } while (opened[index]);
+
+            req[0] = REQUEST_OPEN;
+            put_u32(req + 1, session);
+            put_u16(req + 5, index % w);
+            put_u16(req + 7, index / w);
+            if (!request(self, fd, req, 1 + request_body_size[REQUEST_OPEN], &status, &payload, &payload_len, &payload_cap)
+                || status == RESPONSE_ERROR) {
+                self->failed = true;
+                break;
+            }
+            u32 n = get_u32(payload);
+            for (usize i = 0; i < n; i++) {
+                const u8* tile = payload + 4 + i * RESPONSE_OPENED_TILE_SIZE;
+                opened[get_u16(tile + 2) * w + get_u16(tile)] = 1;
+            }
+        }
+        if (self->failed) {
+            break;
+        }
+
+        req[0] = REQUEST_END;
+        put_u32(req + 1, session);
+        if (!request(self, fd, req, 1 + request_body_size[REQUEST_END], &status, &payload, &payload_len, &payload_cap)
+            || status != RESPONSE_OK) {
+            self->failed = true;
+            break;
+        }
+        self->games++;
+    }
+
+    free(opened);
+    free(payload);
+    close(fd);
+
+    return NULL;
+}
+
+static int compare_u64(const void* a, const void* b)
+{
+    u64 x = *(const u64*)a, y = *(const u64*)b;
+    return (x > y) - (x < y);
+}
+
+static void print_usage(int argc, const char** argv)
+{
+    const char* progname = argc > 0 ? argv[0] : "loadgen";
+    fprintf(stderr, "Usage:\n");
+    fprintf(stderr, "  %s [options]\n", progname);
+    fprintf(stderr, "Options:\n");
+    fprintf(stderr, "  -s <path>   -- socket path (default: \"%s\")\n", SERVER_DEFAULT_SOCKET);
+    fprintf(stderr, "  -c <number> -- concurrent connections (default: 8)\n");
+    fprintf(stderr, "  -d <number> -- duration in seconds (default: 5)\n");
+}
+
+int main(int argc, const char** argv)
+{
+    // Parse options
+    const char* socket_path = SERVER_DEFAULT_SOCKET;
+    usize n_clients = 8;
+    f64 duration = 5.0;
+    for (int i = 1; i < argc; i++) {
+        const char* param = i + 1 < argc ? argv[i + 1] : NULL;
+        bool valid = param != NULL;
+        if (strcmp(argv[i], "-s") == 0 && param) {
+            socket_path = param;
+        } else if (strcmp(argv[i], "-c") == 0 && param) {
+            valid = sscanf(param, USIZE, &n_clients) == 1 && n_clients > 0;
+        } else if (strcmp(argv[i], "-d") == 0 && param) {
+            valid = sscanf(param, "%lf", &duration) == 1 && duration > 0.0;
+        } else {
+            valid = false;
+        }
+        if (!valid) {
+            print_usage(argc, argv);
+            return 1;
+        }
+        i++;
+    }
+
+    Client* clients;
+    if (!(clients = calloc(n_clients, sizeof(Client)))) {
+        panic("Out of memory!");
+    }
+    u64 start = now_ns();
+    for (usize i = 0; i < n_clients; i++) {
+        clients[i].socket_path = socket_path;
+        clients[i].duration = duration;
+        clients[i].seed = start + i;
+        if (pthread_create(&clients[i].thread, NULL, client_run, &clients[i]) != 0) {
+            panic("failed to create client thread");
+        }
+    }
+
+    usize total = 0, games = 0;
+    bool failed = false;
+    for (usize i = 0; i < n_clients; i++) {
+        pthread_join(clients[i].thread, NULL);
+        total += clients[i].latencies_len;
+        games += clients[i].games;
+        failed |= clients[i].failed;
+    }
+    f64 elapsed = (now_ns() - start) / 1e9;
+
+    u64* latencies;
+    if (!(latencies = malloc(max(total, 1) * sizeof(u64)))) {
+        panic("Out of memory!");
+    }
+    for (usize i = 0, n = 0; i < n_clients; i++) {
+        memcpy(latencies + n, clients[i].latencies, clients[i].latencies_len * sizeof(u64));
+        n += clients[i].latencies_len;
+        free(clients[i].latencies);
+    }
+    qsort(latencies, total, sizeof(u64), compare_u64);
+
+    printf("connections: " USIZE "\n", n_clients);
+    printf("requests:    " USIZE " (" USIZE " games)\n", total, games);
+    printf("ops/sec:     %.0f\n", total / elapsed);
+    if (total > 0) {
+        printf("latency p50: %.1f us\n", latencies[total / 2] / 1e3);
+        printf("latency p99: %.1f us\n", latencies[min(total * 99 / 100, total - 1)] / 1e3);
+        printf("latency max: %.1f us\n", latencies[total - 1] / 1e3);
+    }
+
+    free(latencies);
+    free(clients);
+
+    if (failed) {
+        log_err("one or more clients failed");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,196 @@
+#include "../board.h"
+#include "../metrics.h"
+#include "../rng.h"
+
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+// Generate boards and stream their difficulty metrics as CSV to stdout.
+// Boards are generated in chunks by a pool of threads and written in
+// order, so the output only depends on the options, not the threads.
+
+// Boards per chunk claimed by a thread
+#define METRICS_CHUNK 4096
+// Longest line of CSV output
+#define METRICS_LINE_MAX 128
+
+typedef struct {
+    usize w;
+    usize h;
+    usize mines;
+    usize boards;
+    u64 seed;
+    BoardTopology topology;
+    bool quiet; // don't write the CSV, for measuring throughput
+
+    usize next_chunk; // claimed atomically
+    // Chunks are written in order, a thread whose chunk
+    // is done waits for the previous chunks to be written
+    pthread_mutex_t lock;
+    pthread_cond_t written;
+    usize next_write;
+} MetricsJob;
+
+typedef struct {
+    MetricsJob* job;
+    pthread_t thread;
+} MetricsWorker;
+
+static f64 now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void* metrics_worker_run(void* _self)
+{
+    MetricsWorker* self = _self;
+    MetricsJob* job = self->job;
+
+    Board board = board_init_ex(job->w, job->h, job->topology);
+    Metrics metrics = metrics_init();
+    char* out;
+    if (!(out = malloc(METRICS_CHUNK * METRICS_LINE_MAX))) {
+        panic("Out of memory!");
+    }
+
+    for (;;) {
+        usize chunk = __atomic_fetch_add(&job->next_chunk, 1, __ATOMIC_RELAXED);
+        usize first = chunk * METRICS_CHUNK;
+        if (first >= job->boards) {
+            break;
+        }
+        usize last = min(first + METRICS_CHUNK, job->boards);
+
+        usize out_len = 0;
+        for (usize i = first; i < last; i++) {
+            // Every board has its own seed, so any board can be
+            // regenerated from the seed column alone
+            u64 seed = job->seed + i;
+            RNG_XoShiRo256ss rng = rng_xoshiro256ss(seed);
+            board_clear(&board);
+            board_generate(&board, (RNG*)&rng, job->mines, job->w / 2, job->h / 2);
+            BoardMetrics m = metrics_compute(&metrics, &board);
+            if (!job->quiet) {
+                out_len += snprintf(out + out_len, METRICS_LINE_MAX,
+                    USIZE "," U64 "," USIZE "," USIZE "," USIZE "\n",
+                    i, seed, m.bbbv, m.openings, m.isolated);
+            }
+        }
+
+        pthread_mutex_lock(&job->lock);
+        while (job->next_write != chunk) {
+            pthread_cond_wait(&job->written, &job->lock);
+        }
+        fwrite(out, 1, out_len, stdout);
+        job->next_write++;
+        pthread_cond_broadcast(&job->written);
+        pthread_mutex_unlock(&job->lock);
+    }
+
+    free(out);
+    metrics_deinit(&metrics);
+    board_deinit(&board);
+    return NULL;
+}
+
+static void print_usage(int argc, const char** argv)
+{
+    const char* progname = argc > 0 ? argv[0] : "metrics";
+    fprintf(stderr, "Usage:\n");
+    fprintf(stderr, "  %s [options]\n", progname);
+    fprintf(stderr, "Options:\n");
+    fprintf(stderr, "  -s <width>x<height> -- board size (default: 30x16)\n");
+    fprintf(stderr, "  -m <number>         -- number of mines (default: 99)\n");
+    fprintf(stderr, "  -n <number>         -- number of boards (default: 1000000)\n");
+    fprintf(stderr, "  -r <seed>           -- seed of the first board (default: 1)\n");
+    fprintf(stderr, "  -t <number>         -- threads (default: number of CPUs)\n");
+    fprintf(stderr, "  -w                  -- wrap the edges of the board around (torus)\n");
+    fprintf(stderr, "  -q                  -- don't write the CSV, only measure throughput\n");
+    fprintf(stderr, "Boards are generated with the first click in the middle.\n");
+    fprintf(stderr, "Columns: board,seed,3bv,openings,isolated\n");
+}
+
+int main(int argc, const char** argv)
+{
+    // Parse options
+    MetricsJob job = {
+        .w = 30,
+        .h = 16,
+        .mines = 99,
+        .boards = 1000000,
+        .seed = 1,
+    };
+    usize n_threads = max(sysconf(_SC_NPROCESSORS_ONLN), 1);
+    for (int i = 1; i < argc; i++) {
+        const char* param = i + 1 < argc ? argv[i + 1] : NULL;
+        bool valid = param != NULL;
+        if (strcmp(argv[i], "-w") == 0) {
+            job.topology = BOARD_TOPOLOGY_TORUS;
+            continue;
+        } else if (strcmp(argv[i], "-q") == 0) {
+            job.quiet = true;
+            continue;
+        } else if (strcmp(argv[i], "-s") == 0 && param) {
+            valid = sscanf(param, USIZE "x" USIZE, &job.w, &job.h) == 2 && job.w > 0 && job.h > 0;
+        } else if (strcmp(argv[i], "-m") == 0 && param) {
+            valid = sscanf(param, USIZE, &job.mines) == 1;
+        } else if (strcmp(argv[i], "-n") == 0 && param) {
+            valid = sscanf(param, USIZE, &job.boards) == 1;
+        } else if (strcmp(argv[i], "-r") == 0 && param) {
+            valid = sscanf(param, U64, &job.seed) == 1;
+        } else if (strcmp(argv[i], "-t") == 0 && param) {
+            valid = sscanf(param, USIZE, &n_threads) == 1 && n_threads > 0;
+        } else {
+            valid = false;
+        }
+        if (!valid) {
+            print_usage(argc, argv);
+            return 1;
+        }
+        i++;
+    }
+    if (job.mines + 9 > job.w * job.h) {
+        log_err("too many mines for a " USIZE "x" USIZE " board", job.w, job.h);
+        return 1;
+    }
+    if (job.topology == BOARD_TOPOLOGY_TORUS && (job.w < 3 || job.h < 3)) {
+        log_err("a torus needs a board of at least 3x3");
+        return 1;
+    }
+
+    pthread_mutex_init(&job.lock, NULL);
+    pthread_cond_init(&job.written, NULL);
+    MetricsWorker* workers;
+    if (!(workers = calloc(n_threads, sizeof(MetricsWorker)))) {
+        panic("Out of memory!");
+    }
+
+    if (!job.quiet) {
+        printf("board,seed,3bv,openings,isolated\n");
+    }
+    f64 start = now();
+    for (usize i = 0; i < n_threads; i++) {
+        workers[i].job = &job;
+        if (pthread_create(&workers[i].thread, NULL, metrics_worker_run, &workers[i]) != 0) {
+            panic("failed to create metrics thread");
+        }
+    }
+    for (usize i = 0; i < n_threads; i++) {
+        pthread_join(workers[i].thread, NULL);
+    }
+    f64 elapsed = now() - start;
+    fflush(stdout);
+
+    // The CSV goes to stdout, so report on stderr
+    fprintf(stderr, USIZE " boards of " USIZE "x" USIZE "/" USIZE " with " USIZE " threads in %.3f s: %.0f boards/min\n",
+        job.boards, job.w, job.h, job.mines, n_threads, elapsed, job.boards / elapsed * 60.0);
+
+    pthread_cond_destroy(&job.written);
+    pthread_mutex_destroy(&job.lock);
+    free(workers);
+    return 0;
+}